@@ -0,0 +1,75 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+#include <string>
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+/*
+ * A minimal microbenchmark harness.
+ *
+ * A benchmark is defined with the BENCHMARK() macro, and performs
+ * run.iterations() iterations of the operation which is measured. Set
+ * up which should not be measured is done before calling
+ * run.startTiming():
+ *
+ *   BENCHMARK( json_parse )
+ *   {
+ *     std::string input = ...;
+ *     run.setBytes(input.length());
+ *     run.startTiming();
+ *
+ *     for (long i = 0; i < run.iterations(); ++i) {
+ *       Wt::Json::Value v;
+ *       Wt::Json::parse(input, v);
+ *       run.keep(v.type());
+ *     }
+ *   }
+ *
+ * The harness calibrates the number of iterations so that a run takes
+ * a minimum time, and then reports the median of a number of runs.
+ */
+class BenchmarkRun
+{
+public:
+  BenchmarkRun(long iterations);
+
+  long iterations() const { return iterations_; }
+
+  // Starts the measurement (after the set up of the benchmark).
+  void startTiming();
+
+  // Bytes processed by one iteration, to report a throughput.
+  void setBytes(long bytes) { bytes_ = bytes; }
+
+  // Keeps a result, so that the computation is not optimized away.
+  void keep(std::size_t value) { sink_ += value; }
+
+  long bytes() const { return bytes_; }
+  const boost::posix_time::ptime& start() const { return start_; }
+
+private:
+  long iterations_, bytes_;
+  boost::posix_time::ptime start_;
+  static volatile std::size_t sink_;
+};
+
+typedef void (*BenchmarkFunction)(BenchmarkRun& run);
+
+struct BenchmarkRegistration
+{
+  BenchmarkRegistration(const char *name, BenchmarkFunction function);
+};
+
+#define BENCHMARK(name)							\
+  static void name(BenchmarkRun& run);					\
+  static BenchmarkRegistration name##_registration(#name, &name);	\
+  static void name(BenchmarkRun& run)
+
+#endif // BENCHMARK_H_
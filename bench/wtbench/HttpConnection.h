@@ -0,0 +1,81 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef HTTP_CONNECTION_H_
+#define HTTP_CONNECTION_H_
+
+#include <map>
+#include <string>
+
+#include <boost/asio.hpp>
+
+#include "http/Hpack.h"
+#include "http/Http2Frame.h"
+
+/*
+ * A persistent HTTP/1.1 connection, using blocking I/O.
+ *
+ * The connection is reopened when the server closed it. Cookies set by
+ * the server are kept, and sent with the next requests.
+ *
+ * With http2, the connection speaks HTTP/2 with prior knowledge (h2c),
+ * and the requests are sent one after the other as streams of the same
+ * connection.
+ */
+class HttpConnection
+{
+public:
+  struct Response {
+    int status;
+    std::string body;
+    std::size_t bytes; // received, including the headers
+  };
+
+  HttpConnection(const std::string& host, const std::string& port,
+		 bool http2 = false);
+
+  /*
+   * Performs a request. A request which fails on a reused connection is
+   * retried once on a new connection. Returns false (and sets error())
+   * on a network error.
+   */
+  bool request(const std::string& method, const std::string& target,
+	       const std::string& body, Response& response);
+
+  void clearCookies();
+
+  const std::string& error() const { return error_; }
+
+private:
+  boost::asio::io_service ioService_;
+  boost::asio::ip::tcp::socket socket_;
+  boost::asio::streambuf in_;
+  std::string host_, port_;
+  bool http2_, open_;
+  std::map<std::string, std::string> cookies_;
+  std::string error_;
+
+  http::server::Hpack::Encoder encoder_;
+  http::server::Hpack::Decoder decoder_;
+  unsigned nextStreamId_;
+
+  void connect();
+  void close();
+  void exchange(const std::string& method, const std::string& target,
+		const std::string& body, Response& response);
+  void exchange2(const std::string& method, const std::string& target,
+		 const std::string& body, Response& response);
+  std::string cookies() const;
+  void setCookie(const std::string& value);
+
+  std::string readLine();
+  void read(std::size_t n, std::string& result);
+  void readToEnd(std::string& result);
+  void readFrame(http::server::Http2Frame::FrameHeader& header,
+		 std::string& payload);
+};
+
+#endif // HTTP_CONNECTION_H_
@@ -0,0 +1,53 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef SCRIPT_H_
+#define SCRIPT_H_
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/*
+ * A scripted sequence of events, replayed by each simulated client on
+ * a loaded application. A script has one step per line:
+ *
+ *   signal <n>           emits the n-th (from 0) signal that was found
+ *                        in the JavaScript rendered for the session
+ *   signal <id>          emits a signal by its id (e.g. s2a), or a
+ *                        JSignal as <object id>:<name>
+ *   value <n|id> <text>  sets the value of a form object, sent with
+ *                        the next events (n indexes the form objects
+ *                        of the last update)
+ *   wait <ms>            waits (think time)
+ *
+ * Empty lines and lines starting with '#' are ignored.
+ */
+class Script
+{
+public:
+  struct Step {
+    enum Type { Signal, Value, Wait };
+
+    Type type;
+    int index;          // Signal, Value: -1 when target is used
+    std::string target; // Signal, Value: id
+    std::string value;  // Value
+    int ms;             // Wait
+  };
+
+  // Reads a script: returns false and sets error() on a syntax error.
+  bool read(std::istream& in);
+
+  const std::vector<Step>& steps() const { return steps_; }
+  const std::string& error() const { return error_; }
+
+private:
+  std::vector<Step> steps_;
+  std::string error_;
+};
+
+#endif // SCRIPT_H_
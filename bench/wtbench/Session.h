@@ -0,0 +1,75 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef SESSION_H_
+#define SESSION_H_
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "HttpConnection.h"
+#include "Script.h"
+#include "Stats.h"
+
+/*
+ * A simulated Ajax client of a Wt application, which follows the
+ * protocol of the boot page and Wt.js: it loads the boot page and the
+ * application script, and then sends events as 'jsupdate' requests.
+ *
+ * The signals which the client can emit are found by scanning the
+ * rendered JavaScript for Wt._p_.update() calls (DOM event signals) and
+ * argument-less Wt.emit() calls (JSignals), in order of appearance.
+ * The form objects are tracked from Wt._p_.setFormObjects().
+ *
+ * The client does not keep a server push connection open: updates
+ * pushed by the server are received with the response to the next
+ * event.
+ */
+class Session
+{
+public:
+  Session(HttpConnection& http, const std::string& path, Stats& stats);
+
+  // Creates the session, and loads the application.
+  bool start();
+
+  // Replays a script, returns false on an error.
+  bool replay(const Script& script);
+
+  // Ends the session, as a browser does when leaving the page.
+  void quit();
+
+  const std::string& error() const { return error_; }
+
+  // The signals and form objects found so far, to be used in scripts.
+  const std::vector<std::string>& signals() const { return signals_; }
+  const std::vector<std::string>& formObjects() const { return formObjects_; }
+
+private:
+  HttpConnection& http_;
+  std::string path_;
+  Stats& stats_;
+
+  std::string url_; // for Ajax updates
+  std::string ackId_, pageId_;
+  std::vector<std::string> signals_; // encoded events
+  std::set<std::string> knownSignals_;
+  std::vector<std::string> formObjects_;
+  std::map<std::string, std::string> values_;
+  bool load_, quited_;
+  std::string error_;
+
+  bool fetch(Stats::Kind kind, const std::string& method,
+	     const std::string& target, const std::string& body,
+	     std::string& result);
+  bool update(const std::string& event);
+  void scan(const std::string& js);
+  std::string resolve(const std::string& url) const;
+};
+
+#endif // SESSION_H_
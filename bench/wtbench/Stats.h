@@ -0,0 +1,43 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef STATS_H_
+#define STATS_H_
+
+#include <iosfwd>
+#include <vector>
+
+/*
+ * Latencies and response sizes, per kind of request. Each client
+ * records into its own Stats, which are merged for the report.
+ */
+class Stats
+{
+public:
+  enum Kind {
+    Boot,   // the boot page, which creates a session
+    Script, // the application script, which loads the application
+    Event,  // an Ajax update carrying an event
+    KindCount
+  };
+
+  Stats();
+
+  void record(Kind kind, long microseconds, std::size_t bytes);
+  void error();
+
+  void merge(const Stats& other);
+
+  // Writes a table, or JSON, for a run which took the given time.
+  void report(std::ostream& out, double seconds, bool json);
+
+private:
+  std::vector<long> latencies_[KindCount];
+  double bytes_[KindCount];
+  long errors_;
+};
+
+#endif // STATS_H_
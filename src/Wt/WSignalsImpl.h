@@ -0,0 +1,454 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WSIGNALS_IMPL_H_
+#define WSIGNALS_IMPL_H_
+
+#include <cstddef>
+
+#include <boost/ref.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/utility/addressof.hpp>
+#include <boost/visit_each.hpp>
+
+#include <Wt/WDllDefs.h>
+
+/*
+ * Wt's own implementation of Wt::Signals, selected with
+ * WT_SIGNALS_IMPLEMENTATION=wt.
+ *
+ * Signals are only used within a session, under the session lock, and
+ * therefore this implementation does not lock. A connection is a single
+ * allocation which holds the slot function object. The connections of a
+ * signal are kept in an intrusive list, and those bound to a trackable
+ * object also in an intrusive list of that object.
+ *
+ * Slots may connect and disconnect slots, or delete the signal, while
+ * the signal is emitted: disconnected slots are removed from the list
+ * only after the emission, and slots connected during an emission are
+ * not called by it.
+ */
+namespace Wt {
+  namespace Signals {
+
+    enum connect_position { at_back, at_front };
+
+    class trackable;
+    class connection;
+
+    namespace Impl {
+
+      class SignalBase;
+      class SlotBase;
+
+      // A slot which is bound to a trackable object.
+      struct TrackLink {
+	trackable *object;
+	SlotBase *slot;
+	TrackLink *prev, *next; // in the list of the object
+	TrackLink *nextInSlot;
+      };
+
+      class WT_API SlotBase
+      {
+      public:
+	SlotBase();
+
+	void addRef() { ++refCount_; }
+	void release() { if (--refCount_ == 0) delete this; }
+
+	bool connected() const { return !disconnected_; }
+	void disconnect();
+
+	void track(const trackable *object);
+
+      protected:
+	virtual ~SlotBase();
+
+      private:
+	SlotBase *prev_, *next_;
+	SignalBase *signal_;
+	TrackLink link_, *moreLinks_;
+	int refCount_;
+	bool disconnected_;
+
+	void untrack(TrackLink *link);
+
+	friend class SignalBase;
+      };
+
+      class WT_API SignalBase
+      {
+      public:
+	std::size_t num_slots() const { return count_; }
+	bool empty() const { return count_ == 0; }
+
+	void disconnect_all_slots();
+
+      protected:
+	/*
+	 * Keeps track of an emission, which may be nested in another one.
+	 */
+	class WT_API Emission
+	{
+	public:
+	  Emission(const SignalBase *signal);
+	  ~Emission();
+
+	  SlotBase *first() const { return first_; }
+	  SlotBase *next(SlotBase *slot) const;
+	  bool signalDeleted() const { return signal_ == 0; }
+
+	private:
+	  SignalBase *signal_;
+	  Emission *outer_;
+	  SlotBase *first_, *last_;
+
+	  friend class SignalBase;
+	};
+
+	SignalBase();
+	~SignalBase();
+
+	connection connect(SlotBase *slot, connect_position position);
+
+      private:
+	SlotBase *first_, *last_;
+	std::size_t count_;
+	Emission *emission_;
+	bool dirty_;
+
+	SignalBase(const SignalBase&);
+	SignalBase& operator=(const SignalBase&);
+
+	void remove(SlotBase *slot);
+	void unlink(SlotBase *slot);
+	void removeDisconnected();
+
+	friend class SlotBase;
+      };
+
+      // Adds the trackable objects which are bound in a slot function.
+      class TrackVisitor
+      {
+      public:
+	TrackVisitor(SlotBase *slot)
+	  : slot_(slot)
+	{ }
+
+	template <typename T>
+	void operator()(const T& t) const {
+	  visit(t, 0);
+	}
+
+      private:
+	SlotBase *slot_;
+
+	template <typename T>
+	void visit(const T&, long) const { }
+
+	template <typename T>
+	void visit(T *t, int) const {
+	  add(t, boost::is_convertible<T *, const trackable *>());
+	}
+
+	template <typename T>
+	void visit(const boost::reference_wrapper<T>& t, int) const {
+	  visit(t.get_pointer(), 0);
+	}
+
+	template <typename T>
+	void add(T *t, boost::true_type) const {
+	  slot_->track(t);
+	}
+
+	template <typename T>
+	void add(T *, boost::false_type) const { }
+      };
+
+      struct none { };
+
+      template <typename A1, typename A2, typename A3,
+		typename A4, typename A5, typename A6>
+      class Slot : public SlotBase
+      {
+      public:
+	virtual void call(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6) = 0;
+      };
+
+      /*
+       * The slot of a signal with N arguments, which calls F with the
+       * first N arguments.
+       */
+      template <int N, typename F, typename A1, typename A2, typename A3,
+		typename A4, typename A5, typename A6>
+      class FunctionSlot;
+
+      template <typename F, typename A1, typename A2, typename A3,
+		typename A4, typename A5, typename A6>
+      class FunctionSlot<0, F, A1, A2, A3, A4, A5, A6>
+	: public Slot<A1, A2, A3, A4, A5, A6>
+      {
+      public:
+	FunctionSlot(const F& f) : f_(f) { }
+	F f_;
+	virtual void call(A1, A2, A3, A4, A5, A6) { f_(); }
+      };
+
+      template <typename F, typename A1, typename A2, typename A3,
+		typename A4, typename A5, typename A6>
+      class FunctionSlot<1, F, A1, A2, A3, A4, A5, A6>
+	: public Slot<A1, A2, A3, A4, A5, A6>
+      {
+      public:
+	FunctionSlot(const F& f) : f_(f) { }
+	F f_;
+	virtual void call(A1 a1, A2, A3, A4, A5, A6) { f_(a1); }
+      };
+
+      template <typename F, typename A1, typename A2, typename A3,
+		typename A4, typename A5, typename A6>
+      class FunctionSlot<2, F, A1, A2, A3, A4, A5, A6>
+	: public Slot<A1, A2, A3, A4, A5, A6>
+      {
+      public:
+	FunctionSlot(const F& f) : f_(f) { }
+	F f_;
+	virtual void call(A1 a1, A2 a2, A3, A4, A5, A6) { f_(a1, a2); }
+      };
+
+      template <typename F, typename A1, typename A2, typename A3,
+		typename A4, typename A5, typename A6>
+      class FunctionSlot<3, F, A1, A2, A3, A4, A5, A6>
+	: public Slot<A1, A2, A3, A4, A5, A6>
+      {
+      public:
+	FunctionSlot(const F& f) : f_(f) { }
+	F f_;
+	virtual void call(A1 a1, A2 a2, A3 a3, A4, A5, A6) {
+	  f_(a1, a2, a3);
+	}
+      };
+
+      template <typename F, typename A1, typename A2, typename A3,
+		typename A4, typename A5, typename A6>
+      class FunctionSlot<4, F, A1, A2, A3, A4, A5, A6>
+	: public Slot<A1, A2, A3, A4, A5, A6>
+      {
+      public:
+	FunctionSlot(const F& f) : f_(f) { }
+	F f_;
+	virtual void call(A1 a1, A2 a2, A3 a3, A4 a4, A5, A6) {
+	  f_(a1, a2, a3, a4);
+	}
+      };
+
+      template <typename F, typename A1, typename A2, typename A3,
+		typename A4, typename A5, typename A6>
+      class FunctionSlot<5, F, A1, A2, A3, A4, A5, A6>
+	: public Slot<A1, A2, A3, A4, A5, A6>
+      {
+      public:
+	FunctionSlot(const F& f) : f_(f) { }
+	F f_;
+	virtual void call(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6) {
+	  f_(a1, a2, a3, a4, a5);
+	}
+      };
+
+      template <typename F, typename A1, typename A2, typename A3,
+		typename A4, typename A5, typename A6>
+      class FunctionSlot<6, F, A1, A2, A3, A4, A5, A6>
+	: public Slot<A1, A2, A3, A4, A5, A6>
+      {
+      public:
+	FunctionSlot(const F& f) : f_(f) { }
+	F f_;
+	virtual void call(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6) {
+	  f_(a1, a2, a3, a4, a5, a6);
+	}
+      };
+
+      /*
+       * A signal with N arguments: unused arguments are of type none.
+       */
+      template <int N, typename A1 = none, typename A2 = none,
+		typename A3 = none, typename A4 = none,
+		typename A5 = none, typename A6 = none>
+      class Signal : public SignalBase
+      {
+      public:
+	template <typename F>
+	connection connect(const F& f, connect_position position = at_back);
+
+	void invoke(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6) const;
+      };
+    }
+
+    /*
+     * A connection, which can be used to disconnect the slot.
+     */
+    class WT_API connection
+    {
+    public:
+      connection();
+      connection(const connection& other);
+      ~connection();
+
+      connection& operator=(const connection& other);
+
+      bool connected() const;
+      void disconnect() const;
+
+    private:
+      Impl::SlotBase *slot_;
+
+      explicit connection(Impl::SlotBase *slot);
+
+      friend class Impl::SignalBase;
+    };
+
+    /*
+     * Base class for objects which disconnect the slots which they are
+     * bound to (with boost::bind()) when they are deleted.
+     */
+    class WT_API trackable
+    {
+    public:
+      trackable() : links_(0) { }
+      trackable(const trackable&) : links_(0) { }
+      ~trackable();
+
+      trackable& operator=(const trackable&) { return *this; }
+
+    private:
+      Impl::TrackLink *links_;
+
+      friend class Impl::SlotBase;
+    };
+
+    template <typename Signature> class signal;
+
+    template <>
+    class signal<void ()> : public Impl::Signal<0>
+    {
+    public:
+      void operator()() const {
+	invoke(Impl::none(), Impl::none(), Impl::none(),
+	     Impl::none(), Impl::none(), Impl::none());
+      }
+    };
+
+    template <typename A1>
+    class signal<void (A1)> : public Impl::Signal<1, A1>
+    {
+    public:
+      void operator()(A1 a1) const {
+	this->invoke(a1, Impl::none(), Impl::none(),
+		   Impl::none(), Impl::none(), Impl::none());
+      }
+    };
+
+    template <typename A1, typename A2>
+    class signal<void (A1, A2)> : public Impl::Signal<2, A1, A2>
+    {
+    public:
+      void operator()(A1 a1, A2 a2) const {
+	this->invoke(a1, a2, Impl::none(),
+		   Impl::none(), Impl::none(), Impl::none());
+      }
+    };
+
+    template <typename A1, typename A2, typename A3>
+    class signal<void (A1, A2, A3)> : public Impl::Signal<3, A1, A2, A3>
+    {
+    public:
+      void operator()(A1 a1, A2 a2, A3 a3) const {
+	this->invoke(a1, a2, a3, Impl::none(), Impl::none(), Impl::none());
+      }
+    };
+
+    template <typename A1, typename A2, typename A3, typename A4>
+    class signal<void (A1, A2, A3, A4)>
+      : public Impl::Signal<4, A1, A2, A3, A4>
+    {
+    public:
+      void operator()(A1 a1, A2 a2, A3 a3, A4 a4) const {
+	this->invoke(a1, a2, a3, a4, Impl::none(), Impl::none());
+      }
+    };
+
+    template <typename A1, typename A2, typename A3, typename A4,
+	      typename A5>
+    class signal<void (A1, A2, A3, A4, A5)>
+      : public Impl::Signal<5, A1, A2, A3, A4, A5>
+    {
+    public:
+      void operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5) const {
+	this->invoke(a1, a2, a3, a4, a5, Impl::none());
+      }
+    };
+
+    template <typename A1, typename A2, typename A3, typename A4,
+	      typename A5, typename A6>
+    class signal<void (A1, A2, A3, A4, A5, A6)>
+      : public Impl::Signal<6, A1, A2, A3, A4, A5, A6>
+    {
+    public:
+      void operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6) const {
+	this->invoke(a1, a2, a3, a4, a5, a6);
+      }
+    };
+
+    namespace Impl {
+
+      template <int N, typename A1, typename A2, typename A3,
+		typename A4, typename A5, typename A6>
+      template <typename F>
+      connection Signal<N, A1, A2, A3, A4, A5, A6>
+      ::connect(const F& f, connect_position position)
+      {
+	FunctionSlot<N, F, A1, A2, A3, A4, A5, A6> *slot
+	  = new FunctionSlot<N, F, A1, A2, A3, A4, A5, A6>(f);
+
+	// unqualified, to find the overloads of e.g. boost::bind() by ADL
+	using boost::visit_each;
+	TrackVisitor visitor(slot);
+	visit_each(visitor, slot->f_, 0);
+
+	return SignalBase::connect(slot, position);
+      }
+
+      template <int N, typename A1, typename A2, typename A3,
+		typename A4, typename A5, typename A6>
+      void Signal<N, A1, A2, A3, A4, A5, A6>
+      ::invoke(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6) const
+      {
+	Emission emission(this);
+
+	for (SlotBase *s = emission.first(); s; s = emission.next(s)) {
+	  if (!s->connected())
+	    continue;
+
+	  /*
+	   * The slot may delete the signal, which releases the slot:
+	   * keep it alive during the call.
+	   */
+	  s->addRef();
+	  static_cast<Slot<A1, A2, A3, A4, A5, A6> *>(s)
+	    ->call(a1, a2, a3, a4, a5, a6);
+	  s->release();
+
+	  if (emission.signalDeleted())
+	    break;
+	}
+      }
+    }
+  }
+}
+
+#endif // WSIGNALS_IMPL_H_
@@ -0,0 +1,45 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * All rights reserved.
+ */
+
+#ifndef HTTP_BUFFER_POOL_HPP
+#define HTTP_BUFFER_POOL_HPP
+
+#include "Buffer.h"
+
+namespace http {
+namespace server {
+
+/// Pool of connection read buffers.
+/*
+ * A connection only holds a read buffer while there is data to be
+ * read or parsed, so that idle keep-alive, long-poll and WebSocket
+ * connections do not pin a buffer each.
+ *
+ * Released buffers are kept in a free list per thread, so that taking
+ * and returning a buffer does not need a lock. A buffer may be
+ * returned by another thread than the one that took it.
+ */
+class BufferPool
+{
+public:
+  /// Take a buffer from the pool of the current thread.
+  static Buffer *acquire();
+
+  /// Return a buffer to the pool of the current thread.
+  static void release(Buffer *buffer);
+
+  /// The number of buffers that are currently taken.
+  static long buffersInUse();
+
+  /// The number of buffers that are allocated, in use or free.
+  static long buffersAllocated();
+};
+
+} // namespace server
+} // namespace http
+
+#endif // HTTP_BUFFER_POOL_HPP
@@ -24,19 +24,25 @@ typedef boost::system::system_error asio_system_error;
 
 #include <boost/array.hpp>
 #include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/enable_shared_from_this.hpp>
 
 #include "Buffer.h"
+#include "BufferPool.h"
+#include "Metrics.h"
+#include "Tracing.h"
 #include "Reply.h"
 #include "Request.h"
 #include "RequestHandler.h"
 #include "RequestParser.h"
+#include "TimerWheel.h"
 
 namespace http {
 namespace server {
 
 class ConnectionManager;
+class Http2Session;
 class Server;
 
 /// Represents a single connection from a client.
@@ -55,7 +61,7 @@ public:
   /// Start the first asynchronous operation for the connection.
   virtual void start();
 
-  void close();
+  virtual void close();
 
   /// Like CGI's Url scheme: http or https
   virtual std::string urlScheme() = 0;
@@ -70,6 +76,7 @@ public:
 
 #ifdef HTTP_WITH_SSL
   void registerSslHandle(SSL *ssl) { request_.ssl = ssl; }
+  SSL *sslHandle() const { return request_.ssl; }
 #endif
 
 public: // huh?
@@ -86,7 +93,20 @@ public: // huh?
   void handleReadBody();
   bool readAvailable();
 
+  /// Check the timeouts, called by the timer wheel for a given tick.
+  void checkTimeout(long tick);
+
 protected:
+  /// Construct a connection which shares the strand of another one.
+  Connection(asio::strand& strand, Server *server,
+	     ConnectionManager& manager, RequestHandler& handler);
+
+  /// The read buffer, taken from the buffer pool if needed.
+  Buffer& buffer();
+
+  /// Return the read buffer to the pool if all its data has been parsed.
+  void releaseBuffer();
+
   void setReadTimeout(int seconds);
   void setWriteTimeout(int seconds);
 
@@ -97,6 +117,12 @@ protected:
 
   void finishReply();
 
+  /// In a worker process, hand the connection back to the front
+  /// process if the next request is for a session of another worker.
+  ///
+  /// Sets wait if the head of the request is not complete yet.
+  bool handOff(bool& wait);
+
   enum State {
     Idle,
     Reading,
@@ -112,12 +138,12 @@ private:
    * Asynchronoulsy reading a request
    */
   /// Start reading request.
-  virtual void startAsyncReadRequest(Buffer& buffer, int timeout) = 0;
+  virtual void startAsyncReadRequest(int timeout) = 0;
 
   /*
    * Asynchronoulsy reading a request body
    */
-  virtual void startAsyncReadBody(Buffer& buffer, int timeout) = 0;
+  virtual void startAsyncReadBody(int timeout) = 0;
   void handleError(const asio_error_code& e);
   void sendStockReply(Reply::status_type code);
 
@@ -133,16 +159,23 @@ private:
   void cancelReadTimer();
   void cancelWriteTimer();
 
-  void timeout(const asio_error_code& e);
+  void scheduleTimeout(long deadline);
+
+  /// Deadlines (in timer wheel ticks) for reading and writing data, or 0.
+  long readDeadline_, writeDeadline_;
 
-  /// Timer for reading data.
-  asio::deadline_timer readTimer_, writeTimer_;
+  /// The tick for which the connection is linked in the timer wheel, or 0.
+  long timerTick_;
+  TimerWheel::Entry timerEntry_;
 
-  /// Current buffer data, from last operation.
-  Buffer buffer_;
+  /// Current buffer data, from last operation. The buffer is only
+  /// held while it contains data that has not yet been parsed.
+  Buffer *buffer_;
   std::size_t buffer_size_;
   Buffer::iterator remaining_;
 
+  Buffer::iterator bufferEnd() const;
+
   /// The incoming request.
   Request request_;
 
@@ -155,8 +188,22 @@ private:
   /// The reply is complete.
   bool moreDataToSendNow_;
 
+  /// When the current write was started, if metrics are enabled.
+  boost::posix_time::ptime writeStart_;
+
+  /// Start writing, recording the write time in the metrics.
+  void startWrite(const std::vector<asio::const_buffer>& buffers);
+
   /// The server that owns this connection
   Server *server_;
+
+  /// The HTTP/2 session, once the connection has switched to HTTP/2.
+  boost::scoped_ptr<Http2Session> http2_;
+
+  void startHttp2();
+
+  friend class Http2Session;
+  friend class Http2Stream;
 };
 
 typedef boost::shared_ptr<Connection> ConnectionPtr;
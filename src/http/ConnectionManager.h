@@ -43,6 +43,9 @@ public:
   /// Stop all connections.
   void stopAll();
 
+  /// The number of open connections.
+  std::size_t connectionCount();
+
 private:
   /// The managed connections.
   std::set<ConnectionPtr> connections_;
@@ -0,0 +1,104 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * All rights reserved.
+ */
+
+#ifndef HTTP_HPACK_HPP
+#define HTTP_HPACK_HPP
+
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace http {
+namespace server {
+
+/// HPACK header compression for HTTP/2 (RFC 7541).
+namespace Hpack {
+
+  typedef std::pair<std::string, std::string> Header;
+
+  /// Default (and maximum) size of the dynamic table.
+  const std::size_t DEFAULT_TABLE_SIZE = 4096;
+
+  /// The dynamic table, indexed after the static table.
+  class Table
+  {
+  public:
+    Table();
+
+    /// Look up a dynamic entry by its index, which follows the static table.
+    const Header *get(std::size_t index) const;
+
+    /// Find a static or dynamic entry, returning its index (or 0).
+    std::size_t find(const std::string& name, const std::string& value,
+		     bool& valueMatch) const;
+
+    void add(const Header& header);
+    void setMaxSize(std::size_t size);
+    std::size_t maxSize() const { return maxSize_; }
+
+    static std::size_t entrySize(const Header& header);
+
+  private:
+    std::deque<Header> entries_;
+    std::size_t size_, maxSize_;
+
+    void evict(std::size_t size);
+  };
+
+  /// Decoder for request header blocks.
+  class Decoder
+  {
+  public:
+    Decoder();
+
+    /// Decode a header block.
+    /*
+     * Returns false on a compression error, or when the decoded
+     * headers exceed maxHeaderListSize.
+     */
+    bool decode(const unsigned char *begin, const unsigned char *end,
+		std::vector<Header>& headers,
+		std::size_t maxHeaderListSize);
+
+  private:
+    Table table_;
+  };
+
+  /// Encoder for response header blocks.
+  class Encoder
+  {
+  public:
+    Encoder();
+
+    /// Limit the dynamic table to the size allowed by the peer.
+    void setMaxTableSize(std::size_t size);
+
+    /// Start a new header block.
+    void begin(std::string& out);
+
+    /// Encode a header, with a lower-case name.
+    void encode(const std::string& name, const std::string& value,
+		std::string& out);
+
+  private:
+    Table table_;
+    std::size_t minTableSize_;
+    bool tableSizeChanged_;
+  };
+
+  void encodeInteger(unsigned value, int prefixBits, unsigned char first,
+		     std::string& out);
+  void encodeString(const std::string& s, std::string& out);
+  bool decodeHuffman(const unsigned char *begin, const unsigned char *end,
+		     std::string& out);
+
+} // namespace Hpack
+
+} // namespace server
+} // namespace http
+
+#endif // HTTP_HPACK_HPP
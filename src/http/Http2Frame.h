@@ -0,0 +1,102 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * All rights reserved.
+ */
+
+#ifndef HTTP_HTTP2_FRAME_HPP
+#define HTTP_HTTP2_FRAME_HPP
+
+#include <cstddef>
+
+namespace http {
+namespace server {
+
+/// The frame format of HTTP/2 (RFC 7540, sections 4 and 6).
+namespace Http2Frame {
+
+  const std::size_t HEADER_SIZE = 9;
+
+  /*
+   * We do not raise SETTINGS_MAX_FRAME_SIZE, and we do not send larger
+   * frames either, which also keeps DATA frames of streams interleaved.
+   */
+  const std::size_t MAX_SIZE = 16384;
+
+  const long MAX_WINDOW_SIZE = 0x7FFFFFFFL;
+
+  enum Type {
+    DataFrame = 0x0,
+    HeadersFrame = 0x1,
+    PriorityFrame = 0x2,
+    RstStreamFrame = 0x3,
+    SettingsFrame = 0x4,
+    PushPromiseFrame = 0x5,
+    PingFrame = 0x6,
+    GoAwayFrame = 0x7,
+    WindowUpdateFrame = 0x8,
+    ContinuationFrame = 0x9
+  };
+
+  enum Flag {
+    EndStream = 0x1,
+    Ack = 0x1,
+    EndHeaders = 0x4,
+    Padded = 0x8,
+    PriorityFlag = 0x20
+  };
+
+  enum ErrorCode {
+    NoError = 0x0,
+    ProtocolError = 0x1,
+    FlowControlError = 0x3,
+    StreamClosed = 0x5,
+    FrameSizeError = 0x6,
+    RefusedStream = 0x7,
+    Cancel = 0x8,
+    CompressionError = 0x9,
+    EnhanceYourCalm = 0xb
+  };
+
+  enum Setting {
+    HeaderTableSize = 0x1,
+    EnablePush = 0x2,
+    MaxConcurrentStreams = 0x3,
+    InitialWindowSize = 0x4,
+    MaxFrameSize = 0x5,
+    MaxHeaderListSize = 0x6
+  };
+
+  struct FrameHeader {
+    std::size_t length;
+    unsigned type, flags, id;
+  };
+
+  /// Parse the header which starts a frame.
+  void parseHeader(const unsigned char *p, FrameHeader& header);
+
+  /// Check a frame for errors that do not depend on the session.
+  /*
+   * Returns NoError, or the error code. This is an error of the
+   * stream when streamError is set, and otherwise of the connection.
+   */
+  ErrorCode check(const FrameHeader& header, const unsigned char *payload,
+		  bool& streamError);
+
+  /// The range of the data in a DATA or HEADERS frame.
+  /*
+   * Excludes the padding and the priority fields. The frame must have
+   * passed check().
+   */
+  void content(const FrameHeader& header, const unsigned char *payload,
+	       std::size_t& begin, std::size_t& end);
+
+  unsigned get32(const unsigned char *p);
+
+} // namespace Http2Frame
+
+} // namespace server
+} // namespace http
+
+#endif // HTTP_HTTP2_FRAME_HPP
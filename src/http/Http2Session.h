@@ -0,0 +1,157 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * All rights reserved.
+ */
+
+#ifndef HTTP_HTTP2_SESSION_HPP
+#define HTTP_HTTP2_SESSION_HPP
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "Connection.h"
+#include "Hpack.h"
+#include "Http2Frame.h"
+
+namespace http {
+namespace server {
+
+class Http2Stream;
+typedef boost::shared_ptr<Http2Stream> Http2StreamPtr;
+
+/// The HTTP/2 framing layer (RFC 7540) of a connection.
+/*
+ * A session is started on a connection when it receives the HTTP/2
+ * connection preface, either on a cleartext connection (h2c with prior
+ * knowledge) or after ALPN negotiated h2 on a TLS connection.
+ *
+ * The session parses the frames read by the connection, and starts an
+ * Http2Stream for each request. The frames written by all streams are
+ * collected and written by the connection in a single write at a time.
+ *
+ * All methods are called within the strand of the connection, which is
+ * shared by its streams.
+ */
+class Http2Session
+  : private boost::noncopyable
+{
+public:
+  explicit Http2Session(Connection& connection);
+  ~Http2Session();
+
+  /// Send the server connection preface.
+  void start();
+
+  /// Process data read from the connection.
+  void consume(const char *begin, const char *end);
+
+  /// Whether the connection should stop reading.
+  bool closing() const { return closing_; }
+
+  /// Whether no stream is active.
+  bool idle() const { return streams_.empty(); }
+
+  /// Notify that the last write of the connection has completed.
+  void handleWritten();
+
+  /// Stop all streams, when the connection is closed.
+  void close();
+
+  /*
+   * Used by Http2Stream
+   */
+  /// Acknowledge data consumed by a stream, which opens the windows.
+  void acknowledge(Http2Stream& stream, std::size_t size);
+
+  /// Send the response head, as formatted by Reply.
+  void sendHeaders(Http2Stream& stream,
+		   const std::vector<asio::const_buffer>& buffers);
+
+  /// Send response data.
+  void sendData(Http2Stream& stream,
+		const std::vector<asio::const_buffer>& buffers);
+
+  /// End a stream.
+  void finish(Http2Stream& stream);
+
+private:
+  typedef std::map<unsigned, Http2StreamPtr> StreamMap;
+
+  Connection& connection_;
+
+  std::size_t prefaceRemaining_;
+  std::string input_; // an incomplete frame
+
+  Hpack::Decoder decoder_;
+  Hpack::Encoder encoder_;
+
+  StreamMap streams_;
+  unsigned lastStreamId_;
+
+  /// Stream of a header block that continues in CONTINUATION frames.
+  unsigned continuationStream_;
+  bool continuationEndStream_;
+  std::string headerBlock_;
+
+  /// Connection flow-control windows.
+  long sendWindow_, receiveWindow_;
+  std::size_t unacknowledged_;
+
+  /// The peer's SETTINGS_INITIAL_WINDOW_SIZE.
+  long initialWindowSize_;
+
+  /// Frames to be written, and the streams to notify when written.
+  std::string output_;
+  std::vector<Http2StreamPtr> outputStreams_;
+
+  /// Frames being written.
+  std::string writing_;
+  std::vector<Http2StreamPtr> writingStreams_;
+
+  bool closing_, closed_;
+
+  Http2StreamPtr stream(unsigned id) const;
+
+  void processFrame(const Http2Frame::FrameHeader& header,
+		    const unsigned char *payload);
+  void processData(const Http2Frame::FrameHeader& header,
+		   const unsigned char *payload);
+  void processHeaders(const Http2Frame::FrameHeader& header,
+		      const unsigned char *payload);
+  void processContinuation(unsigned flags, unsigned id,
+			   const unsigned char *payload, std::size_t length);
+  void processHeaderBlock(unsigned id, bool endStream);
+  void processSettings(const unsigned char *payload, std::size_t length);
+  void processWindowUpdate(unsigned id, const unsigned char *payload);
+
+  bool requestHead(const std::vector<Hpack::Header>& headers,
+		   std::string& head, bool& hasContentLength);
+  void startStream(const Http2StreamPtr& stream);
+  void closeStream(const Http2StreamPtr& stream);
+
+  void acknowledge(std::size_t size);
+  void queueData(Http2Stream& stream, std::string& data);
+  void abortWrite(Http2Stream& stream);
+
+  void connectionError(unsigned code);
+  void streamError(unsigned id, unsigned code);
+  void resetStream(unsigned id, unsigned code);
+  void windowUpdate(unsigned id, std::size_t increment);
+
+  void frameHeader(std::size_t length, unsigned type, unsigned flags,
+		   unsigned id);
+  void flushData();
+  void flushOutput();
+  void notifyWritten(std::vector<Http2StreamPtr>& streams);
+};
+
+} // namespace server
+} // namespace http
+
+#endif // HTTP_HTTP2_SESSION_HPP
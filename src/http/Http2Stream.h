@@ -0,0 +1,98 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * All rights reserved.
+ */
+
+#ifndef HTTP_HTTP2_STREAM_HPP
+#define HTTP_HTTP2_STREAM_HPP
+
+#include <string>
+
+#include "Connection.h"
+
+namespace http {
+namespace server {
+
+class Http2Session;
+
+/// A single HTTP/2 stream, presented as a connection.
+/*
+ * A stream carries one request and its reply. The session presents
+ * the request headers as an HTTP/2.0 request head, followed by the
+ * request body, so that the request parser and the replies are used
+ * as for an HTTP/1 connection. The reply is written as a response
+ * head, which the session encodes in a HEADERS frame, followed by the
+ * response data, which the session writes in DATA frames.
+ *
+ * A stream shares the strand and socket of its connection, and has no
+ * timeouts of its own.
+ */
+class Http2Stream : public Connection
+{
+public:
+  Http2Stream(const ConnectionPtr& connection, Http2Session& session,
+	      unsigned id);
+
+  virtual asio::ip::tcp::socket& socket();
+  virtual std::string urlScheme();
+
+  virtual void start();
+  virtual void close();
+
+  unsigned id() const { return id_; }
+
+  /// Input received for the stream.
+  void receive(const unsigned char *data, std::size_t size, bool end);
+
+protected:
+  virtual void stop();
+
+  virtual void startAsyncReadRequest(int timeout);
+  virtual void startAsyncReadBody(int timeout);
+  virtual void startAsyncWriteResponse
+      (const std::vector<asio::const_buffer>& buffers, int timeout);
+
+private:
+  typedef void (Connection::*ReadHandler)(const asio_error_code& e,
+					  std::size_t bytes_transferred);
+
+  ConnectionPtr connection_;
+  Http2Session& session_;
+  unsigned id_;
+
+  /// The request head, and request body, of which headRead_ and
+  /// inputRead_ bytes have been read.
+  std::string head_, input_;
+  std::size_t headRead_, inputRead_;
+  bool inputComplete_;
+
+  /// Whether the stream waits for the whole body to know its length.
+  bool deferred_;
+
+  ReadHandler readHandler_;
+
+  /// Response data, of which outputSent_ bytes have been framed.
+  std::string output_;
+  std::size_t outputSent_;
+  std::size_t writeSize_;
+
+  /// Stream flow-control windows.
+  long sendWindow_, receiveWindow_;
+  std::size_t unacknowledged_;
+
+  bool headersSent_, aborted_, closed_;
+
+  void startAsyncRead(ReadHandler handler);
+  void deliver();
+  std::size_t unreadInput() const { return input_.size() - inputRead_; }
+  void discardInput();
+
+  friend class Http2Session;
+};
+
+} // namespace server
+} // namespace http
+
+#endif // HTTP_HTTP2_STREAM_HPP
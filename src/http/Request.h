@@ -72,6 +72,9 @@ public:
   ::int64_t contentLength;
   int webSocketVersion;
 
+  /// The trace of the request, started when its head has been parsed.
+  boost::uint64_t traceId;
+
   std::string request_path;
   std::string request_query;
   std::string request_extra_path;
@@ -139,7 +139,9 @@ private:
   // used for HTTP POST body and ws frame/payload length
   ::int64_t    remainder_;
 
-  char         buf_[4096];
+  /* Batches characters appended to header strings (and holds the ws00
+     handshake key); kept small since it lives as long as the connection. */
+  char         buf_[256];
   unsigned     buf_ptr_;
   std::string *dest_;
   unsigned     maxSize_;
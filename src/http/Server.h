@@ -36,6 +36,7 @@ namespace asio = boost::asio;
 #include "Configuration.h"
 #include "ConnectionManager.h"
 #include "RequestHandler.h"
+#include "TimerWheel.h"
 
 #include "Wt/WLogger"
 
@@ -43,6 +44,7 @@ namespace http {
 namespace server {
 
 class Configuration;
+class WorkerPool;
 
 /// The top-level class of the HTTP server.
 class Server
@@ -50,8 +52,11 @@ class Server
 {
 public:
   /// Construct the server to listen on the specified TCP address and port, and
-  /// serve up files from the given directory.
-  explicit Server(const Configuration& config, Wt::WServer& wtServer);
+  /// serve up files from the given directory. With a worker pool, the
+  /// front process only accepts connections and a worker process only
+  /// serves the connections that it is handed.
+  Server(const Configuration& config, Wt::WServer& wtServer,
+	 WorkerPool *workers = 0);
 
   ~Server();
 
@@ -67,12 +72,21 @@ public:
   /// Returns the http port number.
   int httpPort() const;
 
+  /// Start serving a connection that was handed by the front process.
+  void adoptConnection(int fd);
+
+  /// The worker pool, or 0.
+  WorkerPool *workers() const { return workers_; }
+
   Wt::WebController *controller();
 
   const Configuration &configuration() { return config_; }
 
   asio::io_service &service();
 
+  /// The timer wheel for connection timeouts.
+  TimerWheel &timerWheel() { return timer_wheel_; }
+
 private:
   /// Starts accepting http/https connections
   void startAccept();
@@ -92,6 +106,9 @@ private:
   /// The Wt app server
   Wt::WServer& wt_;
 
+  /// The worker pool
+  WorkerPool *workers_;
+
   /// The logger
   Wt::WLogger accessLogger_;
 
@@ -122,6 +139,9 @@ void handleTimeout(asio::deadline_timer *timer,
 		   const boost::function<void ()>& function,
 		   const asio_error_code& err);
 
+  /// The timer wheel for connection timeouts.
+  TimerWheel timer_wheel_;
+
   /// The connection manager which owns all live connections.
   ConnectionManager connection_manager_;
 
@@ -55,8 +55,8 @@ protected:
 
   virtual void stop();
 
-  virtual void startAsyncReadRequest(Buffer& buffer, int timeout);
-  virtual void startAsyncReadBody(Buffer& buffer, int timeout);
+  virtual void startAsyncReadRequest(int timeout);
+  virtual void startAsyncReadBody(int timeout);
   virtual void startAsyncWriteResponse
       (const std::vector<asio::const_buffer>& buffers, int timeout);
 
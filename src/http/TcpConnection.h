@@ -47,8 +47,8 @@ public:
   virtual std::string urlScheme() { return "http"; }
 
 protected:
-  virtual void startAsyncReadRequest(Buffer& buffer, int timeout);
-  virtual void startAsyncReadBody(Buffer& buffer, int timeout);
+  virtual void startAsyncReadRequest(int timeout);
+  virtual void startAsyncReadBody(int timeout);
   virtual void startAsyncWriteResponse
       (const std::vector<asio::const_buffer>& buffers, int timeout);
 
@@ -56,6 +56,21 @@ protected:
 
   /// Socket for the connection.
   asio::ip::tcp::socket socket_;
+
+private:
+  /// The connection was handed to another process: the socket is
+  /// closed without a shutdown.
+  bool handedOff_;
+
+  /// Peeks again at a request head which is not complete, before it
+  /// may be handed off.
+  asio::deadline_timer handOffTimer_;
+
+  typedef void (Connection::*ReadHandler)(const asio_error_code& e,
+					  std::size_t bytes_transferred);
+
+  void startAsyncRead(ReadHandler handler);
+  void handleReadable(ReadHandler handler, const asio_error_code& e);
 };
 
 typedef boost::shared_ptr<TcpConnection> TcpConnectionPtr;
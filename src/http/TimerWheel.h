@@ -0,0 +1,111 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * All rights reserved.
+ */
+
+#ifndef HTTP_TIMER_WHEEL_HPP
+#define HTTP_TIMER_WHEEL_HPP
+
+#include <vector>
+
+#include <boost/asio.hpp>
+namespace asio = boost::asio;
+typedef boost::system::error_code asio_error_code;
+
+#include <boost/detail/atomic_count.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+#ifdef WT_THREADED
+#include <boost/thread/mutex.hpp>
+#endif // WT_THREADED
+
+namespace http {
+namespace server {
+
+class Connection;
+
+/// Coarse timing wheel for connection timeouts.
+/*
+ * The wheel ticks once per second. A connection is linked in the slot
+ * of its earliest deadline. When a slot expires, each connection in
+ * it is asked, within its own strand, to check its deadlines, and
+ * either times out or links itself again for its next deadline.
+ *
+ * Hence a connection only needs to take the wheel's lock when its
+ * deadline moves earlier than the slot it is linked in. Extending or
+ * cancelling a deadline, as happens for every read and write, only
+ * updates the connection itself.
+ */
+class TimerWheel
+  : private boost::noncopyable
+{
+public:
+  /// The link of a connection in the wheel.
+  class Entry
+  {
+  public:
+    Entry();
+
+  private:
+    Entry *prev_, *next_;
+    long tick_; // the tick of the slot in which it is linked, or 0
+    boost::weak_ptr<Connection> connection_;
+
+    friend class TimerWheel;
+  };
+
+  /// Construct a timer wheel which ticks using the given io_service.
+  explicit TimerWheel(asio::io_service& io_service);
+
+  ~TimerWheel();
+
+  /// Start ticking.
+  void start();
+
+  /// Stop ticking and unlink all connections.
+  void stop();
+
+  /// The current tick, in seconds.
+  long now() const { return now_; }
+
+  /// Link a connection in the slot for a given tick.
+  /*
+   * Unlinks the entry from the slot it was linked in. The tick is
+   * limited to the range of the wheel. Returns the tick of the slot
+   * in which the entry is linked.
+   */
+  long schedule(Entry& entry, const boost::shared_ptr<Connection>& connection,
+		long tick);
+
+  /// Unlink a connection.
+  void remove(Entry& entry);
+
+private:
+  asio::deadline_timer timer_;
+  boost::posix_time::ptime nextTick_;
+  boost::detail::atomic_count now_;
+  bool running_;
+
+  /// Sentinels of a circular list of entries per slot.
+  std::vector<Entry> slots_;
+
+#ifdef WT_THREADED
+  /// Mutex to protect access to slots_
+  boost::mutex mutex_;
+#endif // WT_THREADED
+
+  void startTimer();
+  void tick(const asio_error_code& e);
+
+  void link(Entry& entry, long tick);
+  static void unlink(Entry& entry);
+};
+
+} // namespace server
+} // namespace http
+
+#endif // HTTP_TIMER_WHEEL_HPP
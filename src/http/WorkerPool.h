@@ -0,0 +1,174 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * All rights reserved.
+ */
+
+#ifndef HTTP_WORKER_POOL_HPP
+#define HTTP_WORKER_POOL_HPP
+
+#include <string>
+#include <vector>
+
+#include "Wt/WDllDefs.h"
+
+#include <boost/asio.hpp>
+namespace asio = boost::asio;
+typedef boost::system::error_code asio_error_code;
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#ifdef WT_THREADED
+#include <boost/thread/mutex.hpp>
+#endif // WT_THREADED
+
+namespace Wt {
+  class WServer;
+}
+
+namespace http {
+namespace server {
+
+class Configuration;
+class Server;
+
+/// A table, in memory that is shared by all processes, which maps
+/// session ids onto the worker process that owns the session.
+class SessionTable
+  : private boost::noncopyable
+{
+public:
+  /// Create a table for (at most) the given number of sessions.
+  explicit SessionTable(int maxSessions);
+
+  ~SessionTable();
+
+  /// Register a session, returns false if the id is already taken.
+  bool insert(const std::string& sessionId, int worker);
+
+  /// Unregister a session.
+  void remove(const std::string& sessionId);
+
+  /// Unregister all sessions of a worker.
+  void removeWorker(int worker);
+
+  /// Return the worker that owns a session, or -1.
+  int find(const std::string& sessionId) const;
+
+private:
+  struct Header;
+  struct Slot;
+
+  class Lock;
+
+  std::size_t mappedSize_;
+  Header *header_;
+  Slot *slots_;
+
+  Slot *findSlot(::uint64_t hash) const;
+  void rehash();
+};
+
+/// A pool of worker processes which serve the sessions, while the
+/// front process accepts the connections.
+///
+/// The front process peeks at the first request of a connection, and
+/// hands the socket (using SCM_RIGHTS) to the worker that owns the
+/// session, or to the next worker for a request without a known
+/// session. A worker hands a kept-alive connection back to the front
+/// process when the next request is for a session of another worker.
+class WorkerPool
+  : private boost::noncopyable
+{
+public:
+  WorkerPool(const Configuration& config, Wt::WServer& wtServer);
+
+  ~WorkerPool();
+
+  /// Fork the worker processes. Returns in the front process and in
+  /// each worker process.
+  void spawn();
+
+  /// Returns whether this is a worker process.
+  bool isWorker() const { return worker_ != -1; }
+
+  /// Start handling sockets passed over the channels.
+  void start(Server *server);
+
+  /// Terminate the worker processes (in the front process).
+  void stop();
+
+  /// Route a connection to a worker (in the front process).
+  void dispatch(int fd);
+
+  /// Hand a connection back to the front process if its next request
+  /// is for a session of another worker (in a worker process).
+  ///
+  /// Sets wait, without handing off, if the head of the request has
+  /// not been received completely: the caller should try again later.
+  bool handOff(int fd, bool& wait);
+
+  /// Return the protocol of a connection.
+  static asio::ip::tcp protocol(int fd);
+
+  enum PeekResult {
+    PeekClosed,     ///< the connection was closed
+    PeekIncomplete, ///< more of the request head is expected
+    PeekComplete    ///< the request head, or PEEK_SIZE bytes of it
+  };
+
+  /// Peek at the head of the request which is received on a
+  /// connection, without consuming it.
+  static PeekResult peekRequest(int fd, std::string& request);
+
+  /// Collect the values in a request head that may be a session id
+  /// of the given length: the "wtd" parameter in the request URI,
+  /// and the cookie values.
+  static void sessionIds(const std::string& request, std::size_t length,
+			 std::vector<std::string>& result);
+
+private:
+  struct Channel;
+  struct Pending;
+
+  typedef boost::shared_ptr<Channel> ChannelPtr;
+  typedef boost::shared_ptr<Pending> PendingPtr;
+
+  const Configuration& config_;
+  Wt::WServer& wt_;
+  Server *server_;
+
+  SessionTable *sessions_;
+
+  /// The channels to the workers (in the front process), or the
+  /// channel to the front process (in a worker process).
+  std::vector<ChannelPtr> channels_;
+
+  int worker_;
+  unsigned nextWorker_;
+
+#ifdef WT_THREADED
+  boost::mutex mutex_;
+#endif // WT_THREADED
+
+  void receive(ChannelPtr channel);
+  void handleReceive(ChannelPtr channel, const asio_error_code& e);
+  void handleReadable(PendingPtr pending, const asio_error_code& e);
+  void handleTimeout(PendingPtr pending, const asio_error_code& e);
+  void waitForRequest(PendingPtr pending);
+
+  bool send(Channel& channel, int fd);
+  void workerDied(Channel& channel);
+
+  int owner(const std::string& request);
+  int nextWorker();
+
+  bool registerSessionId(const std::string& oldId, const std::string& newId);
+};
+
+} // namespace server
+} // namespace http
+
+#endif // HTTP_WORKER_POOL_HPP
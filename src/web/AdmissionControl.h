@@ -0,0 +1,123 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef ADMISSION_CONTROL_H_
+#define ADMISSION_CONTROL_H_
+
+#include <deque>
+#include <vector>
+
+#include "Configuration.h"
+#include "TimeUtil.h"
+
+#ifdef WT_THREADED
+#include <boost/thread/mutex.hpp>
+#endif // WT_THREADED
+
+namespace Wt {
+
+class WebController;
+class WebRequest;
+
+/*
+ * Admission control: limits the number of requests that are handled
+ * concurrently, per class of request (new session, event, resource,
+ * static), and in total.
+ *
+ * A request that cannot be admitted waits in the queue of its class,
+ * until it is admitted when another request finishes, or until its
+ * deadline passes, at which point it is answered with a short "busy"
+ * page (503) rather than left to time out. A request is also answered
+ * with the busy page at once when its queue is full, or when it is
+ * handled by a synchronous connector (FastCGI, ISAPI), which cannot
+ * hold on to the request.
+ *
+ * Requests for existing sessions have priority: a request of a class
+ * is only admitted while no request of a class with higher priority
+ * (event, resource, static, new session, in that order) is waiting for
+ * a free slot in the total limit.
+ *
+ * Requests are counted while being handled by the controller, i.e.
+ * while they occupy a thread: a request that waits for server push
+ * events does not count.
+ */
+class AdmissionControl
+{
+public:
+  AdmissionControl(WebController *controller);
+  ~AdmissionControl();
+
+  // Returns whether any limit is configured.
+  bool enabled() const;
+
+  /*
+   * Handles a parsed request: the request is passed to
+   * WebController::handleAdmittedRequest() when admitted, which may be
+   * later from another thread, or it is answered with the busy page.
+   *
+   * Also records the time handling the request in the Metrics, per
+   * class of request.
+   */
+  void handleRequest(WebRequest *request);
+
+  // Answers all queued requests with the busy page.
+  void shutdown();
+
+private:
+  static const int ClassCount = Configuration::NewSessionRequest + 1;
+
+  typedef std::pair<WebRequest *, Configuration::RequestClass> Admitted;
+
+  struct Queued {
+    Queued(WebRequest *aRequest, const Time& aDeadline)
+      : request(aRequest), deadline(aDeadline) { }
+
+    WebRequest *request;
+    Time deadline;
+  };
+
+  WebController *controller_;
+  int running_[ClassCount];
+  int totalRunning_;
+  std::deque<Queued> queues_[ClassCount];
+  bool timerScheduled_;
+
+#ifdef WT_THREADED
+  // mutex to protect access to the counts and queues
+  boost::mutex mutex_;
+#endif // WT_THREADED
+
+  Configuration::RequestClass classify(WebRequest *request);
+
+  /*
+   * Returns whether the request may be handled now. Otherwise, the
+   * request has been queued, or it has been answered with the busy
+   * page.
+   */
+  bool admit(WebRequest *request, Configuration::RequestClass c);
+  void run(WebRequest *request, Configuration::RequestClass c);
+
+  // Releases the slot of an admitted request, when it has been handled.
+  void release(Configuration::RequestClass c);
+
+  bool canRun(Configuration::RequestClass c) const;
+  bool mustWait(Configuration::RequestClass c) const;
+
+  // Dequeues admitted and expired requests, with the mutex held.
+  void dequeue(std::vector<Admitted>& admitted,
+	       std::vector<WebRequest *>& expired);
+  void scheduleTimer();
+  void expire();
+
+  void dispatch(const std::vector<Admitted>& admitted,
+		const std::vector<WebRequest *>& expired);
+  void handleQueued(WebRequest *request, Configuration::RequestClass c);
+  static void serveBusyPage(WebRequest *request);
+};
+
+}
+
+#endif // ADMISSION_CONTROL_H_
@@ -20,6 +20,8 @@
 #include <boost/thread.hpp>
 #endif // WT_CONF_LOCK
 
+#include <boost/function.hpp>
+
 #include "Wt/WApplication"
 
 #include "WebSession.h"
@@ -88,6 +90,45 @@ public:
     ErrorMessageWithStack
   };
 
+  enum ThreadAffinity {
+    NoAffinity,
+    CoreAffinity,
+    NodeAffinity
+  };
+
+  /*
+   * Classes of requests for admission control, in order of priority.
+   */
+  enum RequestClass {
+    EventRequest,      // a request for an existing session
+    ResourceRequest,   // a resource of an existing session
+    StaticRequest,     // a static resource, or content shared by sessions
+    NewSessionRequest  // a request which creates a new session
+  };
+
+  struct AdmissionLimits {
+    AdmissionLimits();
+
+    int maxConcurrent; // 0: no limit
+    int maxQueued;
+    int queueTimeout;  // ms
+  };
+
+  /*
+   * Who may read a monitoring resource (metrics, traces): a client
+   * connecting from one of the allowed addresses, or presenting the
+   * access token as "Authorization: Bearer <token>". When neither is
+   * configured, nobody may.
+   */
+  struct MonitorAccess {
+    std::vector<std::string> allowedAddresses;
+    std::string accessToken;
+
+    bool configured() const;
+    bool allows(const std::string& address,
+		const std::string& authorization) const;
+  };
+
   typedef std::map<std::string, std::string> PropertyMap;
   typedef std::vector<std::string> AgentList;
 
@@ -116,13 +157,18 @@ public:
   void setDefaultEntryPoint(const std::string& path);
   const EntryPointList& entryPoints() const { return entryPoints_; }
   void setNumThreads(int threads);
+  void setSharedStyleSheets(bool enabled);
+  void setSlotScriptPath(const std::string& path);
+  void setStreamPage(bool enabled);
 #endif // WT_TARGET_JAVA
 
   SessionPolicy sessionPolicy() const;
   int numProcesses() const;
   int numThreads() const;
+  ThreadAffinity threadAffinity() const;
   int maxNumSessions() const;
   ::int64_t maxRequestSize() const;
+  int uploadProgressInterval() const;
   ::int64_t isapiMaxMemoryRequestSize() const;
   SessionTracking sessionTracking() const;
   bool reloadIsNewSession() const;
@@ -151,10 +197,21 @@ public:
   bool serializedEvents() const;
   bool webSockets() const;
   bool inlineCss() const;
+  bool sharedStyleSheets() const;
+  bool streamPage() const;
+  std::string slotScriptPath() const;
   bool persistentSessions() const;
   bool progressiveBoot() const;
   bool splitScript() const;
   float maxPlainSessionsRatio() const;
+  int maxConcurrentRequests() const;
+  AdmissionLimits admissionLimits(RequestClass requestClass) const;
+  std::string metricsPath() const;
+  MonitorAccess metricsAccess() const;
+  std::string tracePath() const;
+  MonitorAccess traceAccess() const;
+  double traceSampleRate() const;
+  int traceBufferSize() const;
   bool ajaxPuzzle() const;
   bool sessionIdCookie() const;
   bool cookieChecks() const;
@@ -172,6 +229,14 @@ public:
   void setUseSlashExceptionForInternalPaths(bool enabled);
   void setNeedReadBodyBeforeResponse(bool needed);
 
+  /*
+   * A registry which is notified of new (and renamed) session ids, and
+   * which may refuse a new session id, like the run directory.
+   */
+  typedef boost::function<bool (const std::string& oldId,
+				const std::string& newId)> SessionIdRegistry;
+  void setSessionIdRegistry(const SessionIdRegistry& registry);
+
   std::string generateSessionId();
   bool registerSessionId(const std::string& oldId, const std::string& newId);
 
@@ -195,8 +260,10 @@ private:
   SessionPolicy   sessionPolicy_;
   int             numProcesses_;
   int             numThreads_;
+  ThreadAffinity  threadAffinity_;
   int             maxNumSessions_;
   ::int64_t       maxRequestSize_;
+  int             uploadProgressInterval_;
   ::int64_t       isapiMaxMemoryRequestSize_;
   SessionTracking sessionTracking_;
   bool            reloadIsNewSession_;
@@ -208,6 +275,7 @@ private:
   std::string     valgrindPath_;
   ErrorReporting  errorReporting_;
   std::string     runDirectory_;
+  SessionIdRegistry sessionIdRegistry_;
   int             sessionIdLength_;
   PropertyMap     properties_;
   bool            xhtmlMimeType_;
@@ -216,12 +284,23 @@ private:
   bool            serializedEvents_;
   bool		  webSockets_;
   bool            inlineCss_;
+  bool            sharedStyleSheets_;
+  bool            streamPage_;
+  std::string     slotScriptPath_;
   AgentList       ajaxAgentList_, botList_;
   bool            ajaxAgentWhiteList_;
   bool            persistentSessions_;
   bool            progressiveBoot_;
   bool            splitScript_;
   float           maxPlainSessionsRatio_;
+  int             maxConcurrentRequests_;
+  AdmissionLimits admissionLimits_[NewSessionRequest + 1];
+  std::string     metricsPath_;
+  MonitorAccess   metricsAccess_;
+  std::string     tracePath_;
+  MonitorAccess   traceAccess_;
+  double          traceSampleRate_;
+  int             traceBufferSize_;
   bool            ajaxPuzzle_;
   bool            sessionIdCookie_;
   bool            cookieChecks_;
@@ -0,0 +1,137 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_DATE_TIME_FORMAT_H_
+#define WT_DATE_TIME_FORMAT_H_
+
+#include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include <Wt/WString>
+
+namespace Wt {
+
+class WDate;
+class WTime;
+
+/*
+ * A compiled date/time format pattern.
+ *
+ * The format syntax of WDate, WTime and WDateTime is interpreted once
+ * into a list of tokens for formatting and a list of tokens for
+ * parsing. Compiled patterns are immutable and shared through a
+ * process-wide cache, keyed on the format string and the fields (date,
+ * time or both) that are being formatted, since that determines how
+ * the format string is interpreted.
+ */
+class DateTimeFormat
+{
+public:
+  enum Fields {
+    DateFields = 0x1,
+    TimeFields = 0x2,
+    DateTimeFields = DateFields | TimeFields
+  };
+
+  /*
+   * Returns the compiled pattern for a format, compiling it when it is
+   * not yet in the cache.
+   */
+  static boost::shared_ptr<const DateTimeFormat>
+    get(const WString& format, Fields fields);
+
+  DateTimeFormat(const std::string& format, Fields fields);
+
+  Fields fields() const { return fields_; }
+
+  std::string format(const WDate *date, const WTime *time,
+		     bool localized, int zoneOffset) const;
+
+  void parse(const std::string& v, WDate *date, WTime *time) const;
+
+  /*
+   * ISO-8601 formats, as used by the database backends for date and
+   * datetime values, are recognized and given a fast path.
+   */
+  enum IsoFormat {
+    NotIso,
+    IsoDate,            // yyyy-MM-dd
+    IsoDateTime,        // yyyy-MM-dd HH:mm:ss, or with 'T' separator
+    IsoDateTimeMSecs    // yyyy-MM-dd HH:mm:ss.zzz, or with 'T' separator
+  };
+
+  IsoFormat isoFormat() const { return iso_; }
+
+private:
+  enum TokenType {
+    Literal,
+    Day, DayPadded, ShortDayName, LongDayName,
+    Month, MonthPadded, ShortMonthName, LongMonthName,
+    YearShort, Year,
+    HourSign, Hour, HourPadded, PmHour, PmHourPadded, Minute, MinutePadded,
+    Second, SecondPadded, MSec, MSecPadded, TimeZone,
+    AmPmLower, AmPmUpper
+  };
+
+  struct Token {
+    TokenType type;
+    std::string literal;
+
+    Token(TokenType aType) : type(aType) { }
+    Token(const std::string& aLiteral) : type(Literal), literal(aLiteral) { }
+  };
+
+  enum FieldType {
+    FieldLiteral,
+    FieldDay, FieldMonth, FieldYear,
+    FieldHour, FieldMinute, FieldSecond, FieldMSec,
+    FieldAmPm
+  };
+
+  struct ParseToken {
+    FieldType type;
+    int count;
+    std::string literal;
+
+    ParseToken(FieldType aType, int aCount)
+      : type(aType), count(aCount) { }
+    ParseToken(const std::string& aLiteral)
+      : type(FieldLiteral), count(0), literal(aLiteral) { }
+  };
+
+  std::string formatString_;
+  Fields fields_;
+  IsoFormat iso_;
+  char isoSeparator_;
+
+  std::vector<Token> tokens_;
+  std::vector<ParseToken> parseTokens_;
+  bool useAMPM_, parseAMPM_, unterminatedQuote_;
+
+  void compileFormat();
+  void compileParse();
+
+  bool writeDateSpecial(const std::string& f, unsigned& i);
+  bool writeTimeSpecial(const std::string& f, unsigned& i);
+  void addLiteral(char c);
+  void addParseLiteral(char c);
+
+  void detectIso();
+  void formatIso(std::string& result, const WDate *date,
+		 const WTime *time) const;
+  bool parseIso(const std::string& v, WDate *date, WTime *time) const;
+
+  bool parseField(const ParseToken& t, const std::string& v, unsigned& vi,
+		  int *values, bool& pm, bool& haveAMPM) const;
+
+  void fatalFormatError(int c, const char *cs) const;
+};
+
+}
+
+#endif // WT_DATE_TIME_FORMAT_H_
@@ -165,6 +165,15 @@ public:
    */
   static DomElement *updateGiven(const std::string& el, DomElementType type);
 
+  /*! \brief Creates a reference to an existing element which is moved.
+   *
+   * The element is inserted in its new parent using addChild() or
+   * insertChildAt(), and must have been taken out of the document
+   * earlier in the same response using WT.detach(), so that it is
+   * moved instead of being created again.
+   */
+  static DomElement *getForMove(const std::string& id, DomElementType type);
+
   /*! \brief Returns the JavaScript variable name.
    *
    * This variable name is only defined when the element is being
@@ -237,6 +246,28 @@ public:
    */
   void removeProperty(Wt::Property property);
 
+  /*! \brief Returns whether the element only updates properties.
+   *
+   * This is the case for an update which does not manipulate children,
+   * attributes or event handlers, and has no JavaScript.
+   */
+  bool updatesPropertiesOnly() const;
+
+  /*! \brief Removes properties which are overwritten by a later update.
+   *
+   * Removes the properties which are also set by \p later, an update
+   * of the same element which is rendered after this one. Returns the
+   * number of removed properties.
+   */
+  int removeOverwrittenProperties(const DomElement& later);
+
+  /*! \brief Returns whether the element can be rendered as static HTML.
+   *
+   * This is the case for an element without id, event handlers, timer
+   * or JavaScript.
+   */
+  bool isStatic() const;
+
   /*! \brief Sets a whole map of properties.
    */
   void setProperties(const PropertyMap& properties);
@@ -533,6 +564,7 @@ private:
   bool         minMaxSizeProperties_;
   bool         unstubbed_;
   bool         unwrapped_;
+  bool         moved_;
   DomElement  *replaced_;        // when replaceWith() is called
   DomElement  *insertBefore_;
   DomElementType type_;
@@ -0,0 +1,40 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef HTML_CACHE_H_
+#define HTML_CACHE_H_
+
+#include <string>
+
+namespace Wt {
+
+/*
+ * A process wide cache of the HTML of the contents of immutable
+ * widgets (see WWebWidget::setImmutable()), shared by all sessions.
+ *
+ * A key is also remembered when its contents cannot be cached, so
+ * that a next session does not try again. The cache does not evict
+ * entries: it stops accepting new entries when it holds MaxBytes.
+ */
+class HtmlCache
+{
+public:
+  enum Result {
+    Miss,
+    Hit,
+    Uncacheable
+  };
+
+  static const std::size_t MaxBytes = 16 * 1024 * 1024;
+
+  static Result get(const std::string& key, std::string& html);
+  static void put(const std::string& key, const std::string& html);
+  static void setUncacheable(const std::string& key);
+};
+
+}
+
+#endif // HTML_CACHE_H_
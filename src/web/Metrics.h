@@ -0,0 +1,126 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef METRICS_H_
+#define METRICS_H_
+
+#include <iosfwd>
+#include <string>
+
+#include <boost/function.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <Wt/WDllDefs.h>
+
+namespace Wt {
+
+class Configuration;
+class WResource;
+
+/*
+ * A process wide registry of counters, gauges and latency histograms.
+ *
+ * Each thread records into its own block of counters and histograms,
+ * without locking, and the blocks of all threads are merged only when
+ * the metrics are read. A histogram counts durations in log-linear
+ * buckets (8 buckets per power of two microseconds), which bounds the
+ * error on a reported quantile to 12.5%.
+ *
+ * Recording is disabled until enabled with setEnabled(), which is done
+ * by the WebController when a metrics path is configured.
+ */
+class WT_API Metrics
+{
+public:
+  enum Histogram {
+    QueueTime,           // until handled by the WebController
+    EventRequestTime,    // handling by the WebController, per class
+    ResourceRequestTime,
+    StaticRequestTime,
+    NewSessionRequestTime,
+    SessionLockWait,     // waiting for the session lock
+    SessionRequestTime,  // WebSession::handleRequest()
+    EventTime,           // processing the events of a request
+    RenderTime,          // WebRenderer::serveResponse()
+    HttpRequestTime,     // wthttp: RequestHandler::handleRequest()
+    WriteTime            // wthttp: a single write to the socket
+  };
+
+  static const int HistogramCount = WriteTime + 1;
+
+  enum Counter {
+    Requests,
+    NewSessions,
+    RejectedRequests,
+    UpdateBytes,         // JavaScript of Ajax updates
+    MovedWidgets,        // moved instead of rendered again
+    CoalescedProperties, // property updates which were overwritten
+    HtmlCacheHits,       // contents of immutable widgets
+    HtmlCacheMisses,
+    SessionNodeMigrations // requests handled on another NUMA node
+  };
+
+  static const int CounterCount = SessionNodeMigrations + 1;
+
+  typedef boost::function<long ()> Gauge;
+
+  static bool enabled() { return enabled_; }
+  static void setEnabled(bool enabled);
+
+  static boost::posix_time::ptime now();
+
+  static void record(Histogram histogram,
+		     const boost::posix_time::time_duration& d);
+  static void recordSince(Histogram histogram,
+			  const boost::posix_time::ptime& start);
+  static void increment(Counter counter);
+  static void increment(Counter counter, long n);
+
+  /*
+   * Gauges are sampled when the metrics are read. The name is used as
+   * the metric name, and a gauge with the same name is replaced.
+   */
+  static void addGauge(const std::string& name, const Gauge& gauge);
+  static void removeGauge(const std::string& name);
+
+  // Writes all metrics in the Prometheus text format.
+  static void write(std::ostream& out);
+
+  /*
+   * Creates a resource which serves write() to the clients allowed by
+   * the configuration's metricsAccess().
+   */
+  static WResource *createResource(const Configuration& configuration);
+
+  // Records the time from construction until destruction.
+  class WT_API Timer
+  {
+  public:
+    Timer(Histogram histogram)
+      : histogram_(histogram)
+    {
+      if (enabled_)
+	start_ = now();
+    }
+
+    ~Timer()
+    {
+      if (enabled_ && !start_.is_not_a_date_time())
+	recordSince(histogram_, start_);
+    }
+
+  private:
+    Histogram histogram_;
+    boost::posix_time::ptime start_;
+  };
+
+private:
+  static bool enabled_;
+};
+
+}
+
+#endif // METRICS_H_
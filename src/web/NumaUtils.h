@@ -0,0 +1,43 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_NUMA_UTILS_H_
+#define WT_NUMA_UTILS_H_
+
+#include <string>
+#include <vector>
+
+#include <Wt/WDllDefs.h>
+
+namespace Wt {
+  /*
+   * The NUMA topology of the machine, which is read once (on Linux,
+   * from sysfs). Elsewhere, the machine is a single node.
+   */
+  namespace NumaUtils {
+
+    // Returns whether threads (and processes) can be pinned to CPUs.
+    extern WT_API bool affinitySupported();
+
+    extern WT_API int nodeCount();
+
+    // Returns the node of the CPU on which the calling thread runs.
+    extern WT_API int currentNode();
+
+    // Returns the CPUs of a node, to which the calling thread may be
+    // pinned, or all of these CPUs for a node of -1.
+    extern WT_API std::vector<int> allowedCpus(int node = -1);
+
+    // Pins the calling thread (and the threads it creates) to CPUs.
+    extern WT_API bool pinThread(const std::vector<int>& cpus);
+
+    // Parses a list of CPUs such as "0-7,16-23", as found in sysfs.
+    extern WT_API std::vector<int> parseCpuList(const std::string& cpuList);
+
+  }
+}
+
+#endif // WT_NUMA_UTILS_H_
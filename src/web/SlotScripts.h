@@ -0,0 +1,63 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef SLOT_SCRIPTS_H_
+#define SLOT_SCRIPTS_H_
+
+#include <string>
+
+#include <Wt/WDllDefs.h>
+
+namespace Wt {
+
+class WResource;
+
+/*
+ * A process wide repository of the JavaScript learned by stateless
+ * slots (see WObject::implementStateless()), shared by all sessions.
+ *
+ * Learned JavaScript is stored as a function, taking the ids of the
+ * elements it looks up as arguments, and with its variables renamed,
+ * so that the same slot of similar widgets, in any session, shares
+ * one function. A slot then calls the function by its index in the
+ * client-side array WT_CLASS "_slots".
+ *
+ * JavaScript which cannot be parsed safely (comments, regular
+ * expressions), or which refers to the event handler (e, o, this,
+ * return), is not shared. The repository does not evict functions:
+ * it stops accepting new functions when it holds MaxBytes.
+ */
+class WT_API SlotScripts
+{
+public:
+  static const std::size_t MaxBytes = 4 * 1024 * 1024;
+
+  /*
+   * Returns the index of the function for learned JavaScript, and
+   * sets call to the JavaScript that calls it, or returns -1 if the
+   * JavaScript is not shared.
+   */
+  static int share(const std::string& js, std::string& call);
+
+  // Returns the JavaScript that defines the function with an index.
+  static std::string definition(int index);
+
+  // Returns the number of functions.
+  static int count();
+
+  /*
+   * Creates a resource, which serves the definitions of the first
+   * functions as a script that the browser may cache.
+   */
+  static WResource *createResource();
+
+  // Returns the query for the script with the first count functions.
+  static std::string resourceQuery(int count);
+};
+
+}
+
+#endif // SLOT_SCRIPTS_H_
@@ -0,0 +1,106 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef TRACING_H_
+#define TRACING_H_
+
+#include <iosfwd>
+
+#include <boost/cstdint.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <Wt/WDllDefs.h>
+
+namespace Wt {
+
+class Configuration;
+class WResource;
+
+/*
+ * Request-scoped tracing.
+ *
+ * The connector starts a trace for each request, of which a configured
+ * fraction is sampled. A sampled trace has a non-zero id, which is made
+ * current for the thread that handles the request using a Scope, so
+ * that Spans at the stages of the request pipeline are recorded
+ * against it.
+ *
+ * Spans are kept in a fixed size ring buffer of compact records, which
+ * can be exported in the Chrome trace event format (chrome://tracing).
+ */
+class WT_API Tracing
+{
+public:
+  typedef boost::uint64_t TraceId;
+
+  static bool enabled() { return enabled_; }
+
+  // Enables tracing of a fraction (0 - 1) of the requests.
+  static void configure(double sampleRate, std::size_t bufferSize);
+
+  // Starts a trace for a new request: returns 0 when not sampled.
+  static TraceId startTrace();
+
+  static TraceId currentTrace();
+
+  static void record(TraceId trace, const char *name,
+		     const boost::posix_time::ptime& start,
+		     const boost::posix_time::ptime& end);
+
+  // Writes the buffered spans as Chrome trace event JSON.
+  static void writeChromeTrace(std::ostream& out);
+
+  /*
+   * Creates a resource which serves writeChromeTrace() to the clients
+   * allowed by the configuration's traceAccess().
+   */
+  static WResource *createResource(const Configuration& configuration);
+
+  // Makes a trace current for this thread, during its lifetime.
+  class WT_API Scope
+  {
+  public:
+    Scope(TraceId trace);
+    ~Scope();
+
+  private:
+    TraceId previous_;
+    bool active_;
+  };
+
+  // Records a span against the current trace, if it is sampled. The
+  // name must be a string literal.
+  class WT_API Span
+  {
+  public:
+    Span(const char *name)
+      : name_(name),
+	trace_(enabled_ ? currentTrace() : 0)
+    {
+      if (trace_)
+	start_ = boost::posix_time::microsec_clock::universal_time();
+    }
+
+    ~Span()
+    {
+      if (trace_)
+	record(trace_, name_, start_,
+	       boost::posix_time::microsec_clock::universal_time());
+    }
+
+  private:
+    const char *name_;
+    TraceId trace_;
+    boost::posix_time::ptime start_;
+  };
+
+private:
+  static bool enabled_;
+};
+
+}
+
+#endif // TRACING_H_
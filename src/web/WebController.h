@@ -24,6 +24,7 @@
 
 namespace Wt {
 
+class AdmissionControl;
 class Configuration;
 class EntryPoint;
 
@@ -31,6 +32,7 @@ class WebRequest;
 class WebSession;
 
 class WApplication;
+class WResource;
 class WServer;
 
 #ifndef WT_CNOR
@@ -86,6 +88,15 @@ public:
 
   std::string computeRedirectHash(const std::string& url);
 
+  /*
+   * Registers a style sheet with session-invariant rules, which is
+   * then served by the controller to all sessions. Returns the key
+   * (a hash of the contents) that identifies it in the
+   * "?request=css&v=" URL, or an empty string if the style sheet
+   * cannot be shared, in which case it should be rendered inline.
+   */
+  std::string addSharedStyleSheet(const std::string& css);
+
 #ifndef WT_TARGET_JAVA
   WebController(WServer& server,
 		const std::string& singleSessionId = std::string(),
@@ -129,6 +140,8 @@ public:
 
 private:
   Configuration& conf_;
+  AdmissionControl *admissionControl_;
+  WResource *metricsResource_, *traceResource_, *slotScriptResource_;
   std::string singleSessionId_;
   bool autoExpire_;
   int plainHtmlSessions_, ajaxSessions_;
@@ -140,6 +153,12 @@ private:
 #endif // WT_THREADED
   std::set<std::string> uploadProgressUrls_;
 
+#ifdef WT_THREADED
+  boost::mutex sharedStyleSheetsMutex_;
+#endif // WT_THREADED
+  typedef std::map<std::string, std::string> StyleSheetMap;
+  StyleSheetMap sharedStyleSheets_;
+
   typedef std::map<std::string, boost::shared_ptr<WebSession> > SessionMap;
   SessionMap sessions_;
 
@@ -166,8 +185,17 @@ private:
 
   const EntryPoint *getEntryPoint(WebRequest *request);
 
+  // Handles a parsed request, which has been admitted.
+  void handleAdmittedRequest(WebRequest *request);
+  std::string requestSessionId(WebRequest *request);
+  bool sessionExists(const std::string& sessionId);
+
+  void serveSharedStyleSheet(WebRequest *request);
+
   static std::string appSessionCookie(std::string url);
 
+  friend class AdmissionControl;
+
 #endif // WT_TARGET_JAVA
 
   WServer& server_;
@@ -7,9 +7,13 @@
 #ifndef WEBRENDERER_H_
 #define WEBRENDERER_H_
 
+#include <map>
 #include <string>
 #include <vector>
 #include <set>
+
+#include <boost/weak_ptr.hpp>
+
 #include "Wt/WDateTime"
 #include "Wt/WEnvironment"
 #include "Wt/WStatelessSlot"
@@ -20,6 +24,7 @@ class WebRequest;
 class WebResponse;
 class WebStream;
 class DomElement;
+class EscapeOStream;
 class FileServe;
 
 class WApplication;
@@ -36,6 +41,7 @@ public:
   typedef std::map<std::string, WObject *> FormObjectsMap;
 
   WebRenderer(WebSession& session);
+  ~WebRenderer();
 
   void setTwoPhaseThreshold(int bytes);
 
@@ -48,6 +54,32 @@ public:
   void doneUpdate(WWidget *w);
   void updateFormObjects(WWebWidget *w, bool checkDescendants);
 
+  /*
+   * A rendered widget which is removed from its parent during an event
+   * stays rendered until the next response. When it is inserted again
+   * in a rendered container, its DOM element is moved instead of being
+   * rendered again. Widgets which are not inserted again are marked as
+   * not rendered before the response is rendered.
+   */
+  bool widgetDetached(WWebWidget *w);
+  void widgetReattached(WWebWidget *w);
+  void widgetUnrendered(WWebWidget *w);
+  bool isReattached(const std::string& id) const;
+  bool takeMovedWidget(WWebWidget *w);
+
+  /*
+   * While the contents of an immutable widget is rendered (see
+   * WWebWidget::setImmutable()), widgets are rendered without id, and
+   * DomElement::asHTML() reports elements which still need an id, event
+   * handlers or timers with immutableViolated(). These calls nest:
+   * endImmutable() is passed the result of beginImmutable(), and
+   * returns whether the contents is static.
+   */
+  bool beginImmutable();
+  bool endImmutable(bool previous);
+  bool renderingImmutable() const { return immutableDepth_ > 0; }
+  void immutableViolated() { immutableViolated_ = true; }
+
   void updateFormObjectsList(WApplication *app);
   const FormObjectsMap& formObjects() const;
 
@@ -61,7 +93,12 @@ public:
   int scriptId() const { return scriptId_; }
   int pageId() const { return pageId_; }
 
-  void serveResponse(WebResponse& request);
+  /*
+   * Returns false if the response is a page which is still being
+   * streamed: the renderer then flushes the response when done, and
+   * it may no longer be used.
+   */
+  bool serveResponse(WebResponse& request);
   void serveError(int status, WebResponse& request, 
 		  const std::string& message);
   void serveLinkedCss(WebResponse& request);
@@ -96,7 +133,8 @@ private:
 
   WebSession& session_;
 
-  bool visibleOnly_, rendered_, initialStyleRendered_;
+  bool visibleOnly_, rendered_, initialStyleRendered_, immutableViolated_;
+  int immutableDepth_;
   int twoPhaseThreshold_, pageId_, expectedAckId_, scriptId_;
   std::string solution_;
 
@@ -113,7 +151,11 @@ private:
   void serveJavaScriptUpdate(WebResponse& response);
   void serveMainscript(WebResponse& response);
   void serveBootstrap(WebResponse& request);
-  void serveMainpage(WebResponse& response);
+  bool serveMainpage(WebResponse& response);
+  DomElement *createMainElement(WApplication *app);
+  void renderHeadLinks(WStringStream& out, WApplication *app);
+  void serveMainpageBody(WebResponse& response, FileServe& page,
+			 DomElement *mainElement);
   void serveMainAjax(WStringStream& out);
   void serveWidgetSet(WebResponse& request);
   void collectJavaScript();
@@ -135,6 +177,8 @@ private:
   std::string createFormObjectsList(WApplication *app);
 
   void preLearnStateless(WApplication *app, WStringStream& out);
+  std::string shareLearned(const std::string& js);
+  void loadSlotFunctions(WStringStream& out, WApplication *app);
   WStringStream collectedJS1_, collectedJS2_, invisibleJS_, statelessJS_,
     beforeLoadJS_;
   void collectJS(WStringStream *js);
@@ -152,7 +196,37 @@ private:
 
   typedef std::set<WWidget *> UpdateMap;
   UpdateMap updateMap_;
-  bool learning_, learningIncomplete_, moreUpdates_;
+  bool learning_, learningIncomplete_, moreUpdates_, collecting_;
+
+  typedef std::map<WWebWidget *, bool> DetachedMap; // value: reattached
+  DetachedMap detachedWidgets_;
+  std::vector<std::string> movedIds_;
+
+  /*
+   * Ids of the detached widgets which were reattached, until the
+   * response is collected: the former parent, which may be updated
+   * after the new parent has taken the moved element, must not remove
+   * it.
+   */
+  std::set<std::string> reattachedIds_;
+
+  // the rest of a page of which the head has been flushed
+  FileServe *streamedPage_;
+
+  // functions of SlotScripts: used by learned slots, and defined in
+  // the current page (besides those in the cached script)
+  std::set<int> slotFunctions_, slotFunctionsDefined_;
+  int slotScriptCount_;
+
+#ifndef WT_TARGET_JAVA
+  static void resumeMainpage(boost::weak_ptr<WebSession> session,
+			     WebResponse *response, int pageId);
+  void finishMainpage(WebResponse& response, int pageId);
+#endif // WT_TARGET_JAVA
+
+  void resolveDetached(bool keepReattached);
+  void renderMoves(EscapeOStream& out);
+  void coalesceChanges(std::vector<DomElement *>& changes);
 
   std::string safeJsStringLiteral(const std::string& value);
 
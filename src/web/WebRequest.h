@@ -144,6 +144,15 @@ public:
     return false;
   }
 
+  /*
+   * Returns whether the connector completes the request when it has
+   * been handled, i.e. the response must be done before returning from
+   * WebController::handleRequest().
+   */
+  virtual bool isSynchronous() const {
+    return true;
+  }
+
   bool isWebSocketRequest() const { return webSocketRequest_; }
   void setWebSocketRequest(bool ws) { webSocketRequest_ = ws; }
 
@@ -192,9 +201,16 @@ public:
    */
   virtual WSslInfo *sslInfo() const = 0;
 
+  /*
+   * The trace of this request (see Tracing), 0 if it is not sampled.
+   * It is started by the connector.
+   */
+  boost::uint64_t traceId() const { return traceId_; }
+
 protected:
   const EntryPoint *entryPoint_;
   bool doingAsyncCallbacks_;
+  boost::uint64_t traceId_;
 
   void emulateAsync(ResponseState state);
 
@@ -215,12 +231,17 @@ private:
   bool webSocketRequest_;
   boost::posix_time::ptime start_;
 
+  /* Upload progress, see WebController::requestDataReceived() */
+  boost::posix_time::ptime progressTime_;
+  bool progressListeners_;
+
   static Http::ParameterValues emptyValues_;
 
 #ifndef WT_CNOR
   WriteCallback asyncCallback_;
 #endif // WT_CNOR
 
+  friend class AdmissionControl;
   friend class CgiParser;
   friend class Http::Request;
   friend class WEnvironment;
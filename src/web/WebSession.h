@@ -111,6 +111,7 @@ public:
   WObject *emitStackTop();
 
 #ifndef WT_TARGET_JAVA
+
   const Time& expireTime() const { return expire_; }
   bool shouldDisconnect() const;
 #endif // WT_TARGET_JAVA
@@ -285,6 +286,9 @@ private:
   int deferCount_;
 
 #ifndef WT_TARGET_JAVA
+  // the NUMA node on which the last request was handled
+  int node_;
+
   Time             expire_;
 #endif
 
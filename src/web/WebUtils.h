@@ -45,6 +45,10 @@ extern std::string lowerCase(const std::string& s);
 // sanitize unicode 
 extern void sanitizeUnicode(EscapeOStream& sout, const std::string& text);
 
+// length of the leading run of characters that are valid UTF-8 as single
+// bytes (printable ASCII, tab, line feed and carriage return)
+extern std::size_t validAsciiLength(const char *s, std::size_t length);
+
 // word manipulation (for style class editing)
 extern std::string eraseWord(const std::string& s, const std::string& w);
 extern std::string addWord(const std::string& s, const std::string& w);
@@ -459,13 +459,125 @@ this.insertAt = function(p, c, pos) {
   }
 };
 
+/*
+ * The options of a <select> (without option groups), which have their
+ * index as value. An option is given as [text, flags, styleClass], with
+ * flags 0x1 for disabled and 0x2 for selected.
+ */
+function setOption(o, option) {
+  o.text = option[0];
+  o.disabled = (option[1] & 0x1) != 0;
+  o.selected = (option[1] & 0x2) != 0;
+  o.className = option[2] || '';
+}
+
+function renumberOptions(s, from) {
+  for (var i = from, il = s.options.length; i < il; ++i)
+    s.options[i].value = i;
+}
+
+this.setOptions = function(s, options) {
+  while (s.firstChild)
+    s.removeChild(s.firstChild);
+
+  for (var i = 0, il = options.length; i < il; ++i) {
+    var o = document.createElement('option');
+    s.appendChild(o);
+    setOption(o, options[i]);
+  }
+
+  renumberOptions(s, 0);
+};
+
+/*
+ * changes: pairs of (index, count) of inserted options, or removed
+ *   options when count < 0
+ * options: [index, option] for options with new contents, by their
+ *   index after the changes
+ * selected: the selected index, or -2 to keep the selection
+ */
+this.updateOptions = function(s, changes, options, selected) {
+  var i, il, j, from = s.options.length;
+
+  for (i = 0, il = changes.length; i < il; i += 2) {
+    var pos = changes[i], count = changes[i + 1];
+
+    from = Math.min(from, pos);
+
+    if (count > 0) {
+      var before = s.options[pos] || null;
+      for (j = 0; j < count; ++j)
+	s.insertBefore(document.createElement('option'), before);
+    } else {
+      for (j = 0; j < -count; ++j)
+	s.removeChild(s.options[pos]);
+    }
+  }
+
+  for (i = 0, il = options.length; i < il; ++i)
+    setOption(s.options[options[i][0]], options[i][1]);
+
+  renumberOptions(s, from);
+
+  if (selected != -2)
+    s.selectedIndex = selected;
+};
+
 this.remove = function(id)
 {
   var e = WT.getElement(id);
-  if (e)
+  if (e && e.parentNode) // not if detached
+    e.parentNode.removeChild(e);
+};
+
+/*
+ * An element which is moved to another parent is taken out of the
+ * document with detach() before the other changes of a response, and
+ * inserted at its new place using detached() or reattach(), which
+ * replaces a placeholder with the same id.
+ */
+var detachedElements = {}, detachedCount = 0;
+
+this.detach = function(id)
+{
+  var e = WT.getElement(id);
+  if (e) {
     e.parentNode.removeChild(e);
+    detachedElements[id] = e;
+    ++detachedCount;
+  }
+};
+
+this.detached = function(id)
+{
+  var e = detachedElements[id];
+  if (e) {
+    delete detachedElements[id];
+    --detachedCount;
+  }
+  return e;
 };
 
+this.reattach = function(id)
+{
+  var p = document.getElementById(id), e = WT.detached(id);
+  if (p && e)
+    p.parentNode.replaceChild(e, p);
+};
+
+function findDetached(id) {
+  for (var i in detachedElements) {
+    var e = detachedElements[i];
+    if (e.id == id)
+      return e;
+    var c = e.getElementsByTagName('*');
+    for (var j = 0, jl = c.length; j < jl; ++j)
+      if (c[j].id == id)
+	return c[j];
+  }
+  return null;
+}
+
 this.contains = function(w1, w2) {
   var p = w2.parentNode;
 
@@ -653,6 +765,11 @@ this.cancelEvent = function(e, cancelType) {
 
 this.getElement = function(id) {
   var el = document.getElementById(id);
+  if (!el && detachedCount) {
+    el = findDetached(id);
+    if (el)
+      return el;
+  }
   if (!el)
     for (var i = 0; i < window.frames.length; ++i) {
       try {
@@ -1353,6 +1470,34 @@ this.addStyleSheet = function(uri, media) {
   }
 };
 
+/*
+ * Adds a style sheet with rules that are shared by all sessions. It
+ * follows the inline style sheet, and rules which are added later go
+ * in a new inline style sheet after it, so that the rules keep the
+ * order in which they were added.
+ */
+this.addSharedStyleSheet = function(uri) {
+  var inlineCss = document.getElementById('Wt-inline-css');
+
+  if (document.createStyleSheet || !inlineCss)
+    WT.addStyleSheet(uri, 'all');
+  else {
+    var s = document.createElement('link');
+    s.setAttribute('href', uri);
+    s.setAttribute('type','text/css');
+    s.setAttribute('rel','stylesheet');
+    inlineCss.parentNode.insertBefore(s, inlineCss.nextSibling);
+
+    var css = document.createElement('style');
+    css.setAttribute('type','text/css');
+    inlineCss.removeAttribute('id');
+    css.id = 'Wt-inline-css';
+    s.parentNode.insertBefore(css, s.nextSibling);
+
+    inlineStyleSheet = css.sheet;
+  }
+};
+
 this.windowSize = function() {
   var x, y;
 
@@ -28,13 +28,13 @@ l),K=null,F=false;this.abort=function(){if(u!=null){u.onreadystatechange=new Fun
 this.userData=s;var y=this.script=document.createElement("script");y.id="script"+t;y.setAttribute("src",l+"&"+p);y.onerror=v;document.getElementsByTagName("head")[0].appendChild(y);this.abort=function(){y.parentNode.removeChild(y)}}var l=a,m=null;this.responseReceived=function(){if(m!=null){var p=m;m.script.parentNode.removeChild(m.script);m=null;b(0,"",p.userData)}};this.sendUpdate=function(p,s,t,v){return m=new h(p,s,t,v)};this.setUrl=function(p){l=p}})};this.setHtml=function(a,b,d){function j(l,
 m){var p,s,t;switch(l.nodeType){case 1:p=l.namespaceURI===null?document.createElement(l.nodeName):document.createElementNS(l.namespaceURI,l.nodeName);if(l.attributes&&l.attributes.length>0){s=0;for(t=l.attributes.length;s<t;)p.setAttribute(l.attributes[s].nodeName,l.getAttribute(l.attributes[s++].nodeName))}if(m&&l.childNodes.length>0){s=0;for(t=l.childNodes.length;s<t;){var v=j(l.childNodes[s++],m);v&&p.appendChild(v)}}return p;case 3:case 4:case 5:return document.createTextNode(l.nodeValue)}return null}
 if(g.isIE||_$_INNER_HTML_$_&&!d)if(d)a.innerHTML+=b;else a.innerHTML=b;else{var h;h=new DOMParser;h=h.parseFromString("<div>"+b+"</div>","application/xhtml+xml").documentElement;if(h.nodeType!=1)h=h.nextSibling;if(!d)a.innerHTML="";b=0;for(d=h.childNodes.length;b<d;)a.appendChild(j(h.childNodes[b++],true))}};this.hasTag=function(a,b){return a.nodeType==1&&a.tagName&&a.tagName.toUpperCase()===b};this.insertAt=function(a,b,d){if(a.childNodes.length){var j,h,l;h=j=0;for(l=a.childNodes.length;j<l;++j)if(!$(a.childNodes[j]).hasClass("wt-reparented")){if(h===
-d){a.insertBefore(b,a.childNodes[j]);return}++h}}a.appendChild(b)};this.remove=function(a){(a=g.getElement(a))&&a.parentNode.removeChild(a)};this.contains=function(a,b){for(b=b.parentNode;b&&!g.hasTag(b,"BODY");){if(b==a)return true;b=b.parentNode}return false};this.unstub=function(a,b,d){if(d==1){if(a.style.display!="none")b.style.display=a.style.display}else{b.style.position=a.style.position;b.style.left=a.style.left;b.style.visibility=a.style.visibility}if(a.style.height)b.style.height=a.style.height;
+d){a.insertBefore(b,a.childNodes[j]);return}++h}}a.appendChild(b)};function setOption(a,b){a.text=b[0];a.disabled=(b[1]&1)!=0;a.selected=(b[1]&2)!=0;a.className=b[2]||""}function renumberOptions(a,b){for(var d=a.options.length;b<d;++b)a.options[b].value=b}this.setOptions=function(a,b){for(;a.firstChild;)a.removeChild(a.firstChild);for(var d=0,e=b.length;d<e;++d){var f=document.createElement("option");a.appendChild(f);setOption(f,b[d])}renumberOptions(a,0)};this.updateOptions=function(a,b,d,e){var f,h,i,k=a.options.length;f=0;for(h=b.length;f<h;f+=2){var l=b[f],m=b[f+1];k=Math.min(k,l);if(m>0){var n=a.options[l]||null;for(i=0;i<m;++i)a.insertBefore(document.createElement("option"),n)}else for(i=0;i<-m;++i)a.removeChild(a.options[l])}f=0;for(h=d.length;f<h;++f)setOption(a.options[d[f][0]],d[f][1]);renumberOptions(a,k);if(e!=-2)a.selectedIndex=e};this.remove=function(a){(a=g.getElement(a))&&a.parentNode&&a.parentNode.removeChild(a)};var detachedElements={},detachedCount=0;this.detach=function(a){var b=g.getElement(a);if(b){b.parentNode.removeChild(b);detachedElements[a]=b;++detachedCount}};this.detached=function(a){var b=detachedElements[a];if(b){delete detachedElements[a];--detachedCount}return b};this.reattach=function(a){var b=document.getElementById(a),d=g.detached(a);b&&d&&b.parentNode.replaceChild(d,b)};function findDetached(a){for(var b in detachedElements){var d=detachedElements[b];if(d.id==a)return d;d=d.getElementsByTagName("*");for(var j=0,k=d.length;j<k;++j)if(d[j].id==a)return d[j]}return null}this.contains=function(a,b){for(b=b.parentNode;b&&!g.hasTag(b,"BODY");){if(b==a)return true;b=b.parentNode}return false};this.unstub=function(a,b,d){if(d==1){if(a.style.display!="none")b.style.display=a.style.display}else{b.style.position=a.style.position;b.style.left=a.style.left;b.style.visibility=a.style.visibility}if(a.style.height)b.style.height=a.style.height;
 if(a.style.width)b.style.width=a.style.width;b.style.boxSizing=a.style.boxSizing;d=g.styleAttribute("box-sizing");if(g.vendorPrefix(d))b.style[d]=a.style[d]};this.saveReparented=function(a){$(a).find(".wt-reparented").each(function(){$(".Wt-domRoot").get(0).appendChild(this.parentNode.removeChild(this))})};this.changeTag=function(a,b){var d=document.createElement(b);if(b=="img"&&d.mergeAttributes){d.mergeAttributes(a,false);d.src=a.src}else if(a.attributes&&a.attributes.length>0){var j;b=0;for(j=
 a.attributes.length;b<j;b++){var h=a.attributes[b].nodeName;h!="type"&&h!="name"&&d.setAttribute(h,a.getAttribute(h))}}for(;a.firstChild;)d.appendChild(a.removeChild(a.firstChild));a.parentNode.replaceChild(d,a)};this.unwrap=function(a){a=g.getElement(a);if(a.parentNode.className.indexOf("Wt-wrap")){if(a.getAttribute("type")=="submit"){a.setAttribute("type","button");a.removeAttribute("name")}else if(g.hasTag(a,"A")&&a.href.indexOf("&signal=")!=-1)a.href="javascript:void(0)";g.hasTag(a,"INPUT")&&
 a.getAttribute("type")=="image"&&g.changeTag(a,"img")}else{var b=a;a=a.parentNode;if(a.className.length>=8)b.className=a.className.substring(8);var d=a.getAttribute("style");if(d)g.isIE?b.style.setAttribute("cssText",d):b.setAttribute("style",d);a.parentNode.replaceChild(b,a)}};this.navigateInternalPath=function(a,b){a=a||window.event;if(!a.ctrlKey&&!a.metaKey&&g.button(a)<=1){g.history.navigate(b,true);g.cancelEvent(a,g.CancelDefaultAction)}};this.ajaxInternalPaths=function(a){$(".Wt-ip").each(function(){var b=
 this.getAttribute("href"),d=b.lastIndexOf("?wtd");if(d===-1)d=b.lastIndexOf("&wtd");if(d!==-1)b=b.substr(0,d);var j;if(b.indexOf("://")!=-1){d=document.createElement("div");d.innerHTML='<a href="'+a+'">x</a>';j=b.substr(d.firstChild.href.length-1)}else{for(;b.substr(0,3)=="../";)b=b.substr(3);if(b.charAt(0)!="/")b="/"+b;j=b.substr(a.length)}if(j.length==0||j.charAt(0)!="/")j="/"+j;if(j.substr(0,4)=="/?_=")j=j.substr(4);this.setAttribute("href",b);this.setAttribute("href",this.href);this.onclick=function(h){g.navigateInternalPath(h,
 j)};$(this).removeClass("Wt-ip")})};this.resolveRelativeAnchors=function(){window.$&&$(".Wt-rr").each(function(){this.href&&this.setAttribute("href",this.href);this.src&&this.setAttribute("src",this.src);$(this).removeClass("Wt-rr")})};var Y=false;this.CancelPropagate=1;this.CancelDefaultAction=2;this.CancelAll=3;this.cancelEvent=function(a,b){if(!Y){b=b===undefined?g.CancelAll:b;if(b&g.CancelDefaultAction)if(a.preventDefault)a.preventDefault();else a.returnValue=false;if(b&g.CancelPropagate){if(a.stopPropagation)a.stopPropagation();
-else a.cancelBubble=true;try{document.activeElement&&document.activeElement.blur&&g.hasTag(document.activeElement,"TEXTAREA")&&document.activeElement.blur()}catch(d){}}}};this.$=this.getElement=function(a){var b=document.getElementById(a);if(!b)for(var d=0;d<window.frames.length;++d)try{if(b=window.frames[d].document.getElementById(a))return b}catch(j){}return b};this.filter=function(a,b,d){a=String.fromCharCode(typeof b.charCode!=="undefined"?b.charCode:b.keyCode);(new RegExp(d)).test(a)||g.cancelEvent(b)};
+else a.cancelBubble=true;try{document.activeElement&&document.activeElement.blur&&g.hasTag(document.activeElement,"TEXTAREA")&&document.activeElement.blur()}catch(d){}}}};this.$=this.getElement=function(a){var b=document.getElementById(a);if(!b&&detachedCount)if(b=findDetached(a))return b;if(!b)for(var d=0;d<window.frames.length;++d)try{if(b=window.frames[d].document.getElementById(a))return b}catch(j){}return b};this.filter=function(a,b,d){a=String.fromCharCode(typeof b.charCode!=="undefined"?b.charCode:b.keyCode);(new RegExp(d)).test(a)||g.cancelEvent(b)};
 this.widgetPageCoordinates=function(a,b){var d=0,j=0,h;if(!a.parentNode)return{x:0,y:0};if(g.hasTag(a,"AREA"))a=a.parentNode.nextSibling;for(var l=$(document.body).hasClass("Wt-rtl");a&&a!==b;){d+=a.offsetLeft;j+=a.offsetTop;if(g.css(a,"position")=="fixed"){d+=document.body.scrollLeft+document.documentElement.scrollLeft;j+=document.body.scrollTop+document.documentElement.scrollTop;break}h=a.offsetParent;if(h==null)a=null;else{do{a=a.parentNode;if(g.hasTag(a,"DIV")){if(l&&!g.isGecko){if(a.scrollWidth>
 a.parentNode.scrollWidth)d-=a.scrollLeft+a.parentNode.scrollWidth-a.scrollWidth}else d-=a.scrollLeft;j-=a.scrollTop}}while(a!=null&&a!=h)}}return{x:d,y:j}};this.widgetCoordinates=function(a,b){b=g.pageCoordinates(b);a=g.widgetPageCoordinates(a);return{x:b.x-a.x,y:b.y-a.y}};this.pageCoordinates=function(a){if(!a)a=window.event;var b=0,d=0;if(typeof a.pageX==="number"){b=a.pageX;d=a.pageY}else if(typeof a.clientX==="number"){b=a.clientX+document.body.scrollLeft+document.documentElement.scrollLeft;d=
 a.clientY+document.body.scrollTop+document.documentElement.scrollTop}return{x:b,y:d}};this.windowCoordinates=function(a){a=g.pageCoordinates(a);return{x:a.x-document.body.scrollLeft-document.documentElement.scrollLeft,y:a.y-document.body.scrollTop-document.documentElement.scrollTop}};this.wheelDelta=function(a){var b=0;if(a.wheelDelta)b=a.wheelDelta>0?1:-1;else if(a.detail)b=a.detail<0?1:-1;return b};this.scrollIntoView=function(a){setTimeout(function(){var b=a.indexOf("#");if(b!=-1)a=a.substr(b+
@@ -50,7 +50,7 @@ function(a){na();if(!(G&&a)){G=a;var b=document.body;document.body.addEventListe
 else{b=b.getElementsByTagName("*");for(var d=[],j,h=0,l=b.length;h<l;h++){j=b[h];j.className.indexOf(a)!=-1&&d.push(j)}return d}};var T=null;this.addCss=function(a,b){var d=ia();d.insertRule(a+" { "+b+" }",d.cssRules?d.cssRules.length:0)};this.addCssText=function(a){var b=document.getElementById("Wt-inline-css");if(!b){b=document.createElement("style");b.id="Wt-inline-css";document.getElementsByTagName("head")[0].appendChild(b)}if(b.styleSheet){var d=b.previousSibling;if(!d||!g.hasTag(d,"STYLE")||
 d.styleSheet.cssText.length>32768){d=document.createElement("style");b.parentNode.insertBefore(d,b);d.styleSheet.cssText=a}else d.styleSheet.cssText+=a}else{a=document.createTextNode(a);b.appendChild(a)}};this.getCssRule=function(a,b){a=a.toLowerCase();if(document.styleSheets)for(var d=0;d<document.styleSheets.length;d++){var j=document.styleSheets[d],h=0,l;do{l=null;try{if(j.cssRules)l=j.cssRules[h];else if(j.rules)l=j.rules[h];if(l&&l.selectorText)if(l.selectorText.toLowerCase()==a)if(b=="delete"){j.cssRules?
 j.deleteRule(h):j.removeRule(h);return true}else return l}catch(m){}++h}while(l)}return false};this.removeCssRule=function(a){return g.getCssRule(a,"delete")};this.addStyleSheet=function(a,b){if(document.createStyleSheet)setTimeout(function(){document.createStyleSheet(a)},15);else{var d=document.createElement("link");d.setAttribute("href",a);d.setAttribute("type","text/css");d.setAttribute("rel","stylesheet");b!=""&&b!="all"&&d.setAttribute("media",b);b=document.getElementsByTagName("link");if(b.length>
-0){b=b[b.length-1];b.parentNode.insertBefore(d,b.nextSibling)}else document.body.appendChild(d)}};this.windowSize=function(){var a,b;if(typeof window.innerWidth==="number"){a=window.innerWidth;b=window.innerHeight}else{a=document.documentElement.clientWidth;b=document.documentElement.clientHeight}return{x:a,y:b}};this.fitToWindow=function(a,b,d,j,h){var l=["left","right"],m=["top","bottom"];a.style[l[0]]=a.style[l[1]]="auto";a.style[m[0]]=a.style[m[1]]="auto";var p=a.offsetWidth,s=a.offsetHeight,
+0){b=b[b.length-1];b.parentNode.insertBefore(d,b.nextSibling)}else document.body.appendChild(d)}};this.addSharedStyleSheet=function(a){var b=document.getElementById("Wt-inline-css");if(document.createStyleSheet||!b)g.addStyleSheet(a,"all");else{var d=document.createElement("link");d.setAttribute("href",a);d.setAttribute("type","text/css");d.setAttribute("rel","stylesheet");b.parentNode.insertBefore(d,b.nextSibling);var j=document.createElement("style");j.setAttribute("type","text/css");b.removeAttribute("id");j.id="Wt-inline-css";d.parentNode.insertBefore(j,d.nextSibling);T=j.sheet}};this.windowSize=function(){var a,b;if(typeof window.innerWidth==="number"){a=window.innerWidth;b=window.innerHeight}else{a=document.documentElement.clientWidth;b=document.documentElement.clientHeight}return{x:a,y:b}};this.fitToWindow=function(a,b,d,j,h){var l=["left","right"],m=["top","bottom"];a.style[l[0]]=a.style[l[1]]="auto";a.style[m[0]]=a.style[m[1]]="auto";var p=a.offsetWidth,s=a.offsetHeight,
 t=g.windowSize(),v=document.body.scrollLeft+document.documentElement.scrollLeft,y=document.body.scrollTop+document.documentElement.scrollTop;if(!$(a).hasClass("Wt-tooltip")){p=g.px(a,"maxWidth")||p;s=g.px(a,"maxHeight")||s}var z=a.offsetParent;if(z){var u=g.widgetPageCoordinates(z);if(p>t.x){b=v;j=0}else if(b+p>v+t.x){p=z.scrollLeft;if(z==document.body)p=z.clientWidth-t.x;j=j-u.x+p;b=z.clientWidth-(j+g.px(a,"marginRight"));j=1}else{p=z.scrollLeft;if(z==document.body)p=0;b=b-u.x+p;b-=g.px(a,"marginLeft");
 j=0}if(s>t.y){d=y;h=0}else if(d+s>y+t.y){if(h>y+t.y)h=y+t.y;s=z.scrollTop;if(z==document.body)s=z.clientHeight-t.y;h=h-u.y+s;d=z.clientHeight-(h+g.px(a,"marginBottom"));h=1}else{s=z.scrollTop;if(z==document.body)s=0;d=d-u.y+s;d-=g.px(a,"marginTop");h=0}a.style[l[j]]=b+"px";a.style[m[h]]=d+"px"}};this.positionXY=function(a,b,d){a=g.getElement(a);if(!g.isHidden(a)){a.style.display="block";g.fitToWindow(a,b,d,b,d)}};this.Horizontal=1;this.Vertical=2;this.positionAtWidget=function(a,b,d,j){a=g.getElement(a);
 var h=g.getElement(b);j||(j=0);if(h&&a){var l=g.widgetPageCoordinates(h),m;a.style.position="absolute";if(g.css(a,"display")=="none")a.style.display="block";if(d===g.Horizontal){d=l.x+h.offsetWidth;b=l.y+j;m=l.x;j=l.y+h.offsetHeight-j}else{d=l.x;b=l.y+h.offsetHeight;m=l.x+h.offsetWidth;j=l.y}if(!a.wtNoReparent&&!$(a).hasClass("wt-no-reparent")){l=h;var p=$(".Wt-domRoot").get(0);a.parentNode.removeChild(a);for(h=l.parentNode;h!=p;h=h.parentNode){if(h.wtResize){h=l;break}if(g.css(h,"display")!="inline"&&
@@ -0,0 +1,90 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2013 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef TEST_RESPONSE_H_
+#define TEST_RESPONSE_H_
+
+#include <iostream>
+#include <sstream>
+
+#include <Wt/WApplication>
+
+#include "web/WebRenderer.h"
+#include "web/WebRequest.h"
+#include "web/WebSession.h"
+
+namespace Wt {
+
+/*
+ * An Ajax update request, which keeps the JavaScript of the response.
+ */
+class TestResponse : public WebResponse
+{
+public:
+  TestResponse() {
+    setResponseType(Update);
+  }
+
+  std::string output() const { return out_.str(); }
+
+  virtual void flush(ResponseState state, const WriteCallback& callback)
+  { }
+
+  virtual std::istream& in() { return in_; }
+  virtual std::ostream& out() { return out_; }
+  virtual std::ostream& err() { return std::cerr; }
+
+  virtual void setRedirect(const std::string& url) { }
+  virtual void setStatus(int status) { }
+  virtual void setContentType(const std::string& value) { }
+  virtual void setContentLength(::int64_t length) { }
+  virtual void addHeader(const std::string& name, const std::string& value)
+  { }
+
+  virtual std::string envValue(const std::string& name) const {
+    return std::string();
+  }
+
+  virtual std::string serverName() const { return "localhost"; }
+  virtual std::string serverPort() const { return "80"; }
+  virtual std::string scriptName() const { return "/"; }
+  virtual std::string requestMethod() const { return "POST"; }
+  virtual std::string queryString() const { return std::string(); }
+  virtual std::string pathInfo() const { return std::string(); }
+  virtual std::string remoteAddr() const { return "127.0.0.1"; }
+  virtual std::string urlScheme() const { return "http"; }
+
+  virtual std::string headerValue(const std::string& name) const {
+    return std::string();
+  }
+
+  virtual WSslInfo *sslInfo() const { return 0; }
+
+private:
+  std::istringstream in_;
+  std::ostringstream out_;
+};
+
+// Returns the JavaScript of an Ajax update
+inline std::string update(WApplication& app)
+{
+  TestResponse response;
+  app.session()->renderer().serveResponse(response);
+  return response.output();
+}
+
+// Renders the application, as for the first response
+inline void render(WApplication& app)
+{
+  std::stringstream html;
+  app.domRoot()->htmlText(html);
+  app.session()->renderer().setRendered(true);
+  update(app);
+}
+
+}
+
+#endif // TEST_RESPONSE_H_